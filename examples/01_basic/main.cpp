@@ -3,7 +3,7 @@
 #include <filesystem>
 #include <iostream>
 
-using HelpFlag     = CLArgs::Flag<"--help,-h", "Show help menu">;
+using HelpFlag     = CLArgs::Flag<"--help,-h", "Show help menu", CLArgs::FlagBehavior::Terminating>;
 using VerboseFlag  = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
 using ConfigOption = CLArgs::Option<"--config,--configuration,-c", "<filepath>", "Specify config file", std::filesystem::path>;
 
@@ -0,0 +1,247 @@
+#ifndef CLARGS_ARGV_HPP
+#define CLARGS_ARGV_HPP
+
+#include <CLArgs/core.hpp>
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/value_container.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CLArgs
+{
+    // Replaces the value of a Parsable in to_argv(). Only a reference is
+    // kept, so it is meant to be created in the to_argv() call itself.
+    template <Parsable P>
+    struct ValueOverride
+    {
+        using ParsableType = P;
+
+        const typename P::ValueType &value;
+    };
+
+    // Leaves a Parsable out of to_argv(), whatever its current value is
+    template <Parsable P>
+    struct OmitValue
+    {
+        using ParsableType = P;
+    };
+
+    template <Parsable P>
+    [[nodiscard]] constexpr ValueOverride<P> override_value(const typename P::ValueType &value) noexcept;
+
+    template <Parsable P>
+    inline constexpr OmitValue<P> omit_value{};
+
+    // A null-terminated argument vector, e.g. for posix_spawn() or execv().
+    // All tokens live in one character buffer next to one pointer array, so
+    // building it costs two allocations, regardless of the number of tokens.
+    class Argv
+    {
+    public:
+        Argv(std::size_t token_count, std::size_t character_count, std::pmr::memory_resource *resource);
+
+        // Moving keeps the character buffer in place, so the pointers stay valid.
+        // Assignment is not offered, as it could reallocate it.
+        Argv(const Argv &) = delete;
+        Argv(Argv &&)      = default;
+
+        Argv &operator=(const Argv &) = delete;
+        Argv &operator=(Argv &&)      = delete;
+
+        [[nodiscard]] char *const     *data() const noexcept;
+        [[nodiscard]] std::size_t      size() const noexcept;
+        [[nodiscard]] std::string_view operator[](std::size_t index) const noexcept;
+
+        // Appends a token of the given length, to be filled in by the caller
+        char *append(std::size_t length) noexcept;
+
+    private:
+        std::pmr::vector<char>   characters_;
+        std::pmr::vector<char *> pointers_;
+        std::size_t              characters_used_{0};
+    };
+
+    // Renders the explicitly set values back into the canonical command line,
+    // using the first identifier of every Parsable, so that parsing the result
+    // yields the same values. Overrides are applied in order. Values that
+    // Parser::parse_into() only wrote into its config struct must be
+    // overridden or omitted, otherwise std::logic_error is thrown. Lists with
+    // an element containing list_delimiter, which would be parsed back as
+    // more elements, throw std::invalid_argument.
+    template <Parsable... Parsables, typename... Overrides>
+    [[nodiscard]] Argv to_argv(std::string_view program, const ValueContainer<Parsables...> &values, const Overrides &...overrides);
+
+    template <Parsable P, Parsable... Parsables, typename... Overrides>
+    [[nodiscard]] const typename P::ValueType *effective_value(const ValueContainer<Parsables...> &values,
+                                                              const Overrides &...overrides) noexcept;
+} // namespace CLArgs
+
+template <CLArgs::Parsable P>
+constexpr CLArgs::ValueOverride<P>
+CLArgs::override_value(const typename P::ValueType &value) noexcept
+{
+    return ValueOverride<P>{value};
+}
+
+inline CLArgs::Argv::Argv(const std::size_t token_count, const std::size_t character_count, std::pmr::memory_resource *resource)
+    : characters_(character_count, '\0', resource)
+    , pointers_(resource)
+{
+    pointers_.reserve(token_count + 1);
+    pointers_.push_back(nullptr);
+}
+
+inline char *const *
+CLArgs::Argv::data() const noexcept
+{
+    return pointers_.data();
+}
+
+inline std::size_t
+CLArgs::Argv::size() const noexcept
+{
+    // A moved-from Argv has no pointer array, not even the null terminator
+    return pointers_.empty() ? 0 : pointers_.size() - 1;
+}
+
+inline std::string_view
+CLArgs::Argv::operator[](const std::size_t index) const noexcept
+{
+    return pointers_[index];
+}
+
+inline char *
+CLArgs::Argv::append(const std::size_t length) noexcept
+{
+    // Capacity for every token was reserved up front, so this never reallocates
+    char *const token = characters_.data() + characters_used_;
+    characters_used_ += length + 1;
+
+    pointers_.back() = token;
+    pointers_.push_back(nullptr);
+    return token;
+}
+
+template <CLArgs::Parsable P, CLArgs::Parsable... Parsables, typename... Overrides>
+const typename P::ValueType *
+CLArgs::effective_value(const ValueContainer<Parsables...> &values, const Overrides &...overrides) noexcept
+{
+    const auto                  &value  = values.template get_value<P>();
+    const typename P::ValueType *result = values.template is_set<P>() && value.has_value() ? &*value : nullptr;
+
+    (
+        [&result](const auto &override)
+        {
+            using Override = std::remove_cvref_t<decltype(override)>;
+            if constexpr (std::is_same_v<Override, ValueOverride<P>>)
+            {
+                result = &override.value;
+            }
+            else if constexpr (std::is_same_v<Override, OmitValue<P>>)
+            {
+                result = nullptr;
+            }
+        }(overrides),
+        ...);
+
+    return result;
+}
+
+template <CLArgs::Parsable... Parsables, typename... Overrides>
+CLArgs::Argv
+CLArgs::to_argv(const std::string_view program, const ValueContainer<Parsables...> &values, const Overrides &...overrides)
+{
+    static_assert(((std::is_same_v<Overrides, ValueOverride<typename Overrides::ParsableType>> ||
+                    std::is_same_v<Overrides, OmitValue<typename Overrides::ParsableType>>) &&
+                   ...),
+                  "to_argv() only accepts override_value<>() and omit_value<> as overrides");
+
+    const auto check_renderable = [&values, &overrides...]<Parsable P>()
+    {
+        // Values converted into a config struct by Parser::parse_into() are
+        // not held by values, so they must be overridden or omitted
+        if constexpr (!(std::is_same_v<typename Overrides::ParsableType, P> || ...))
+        {
+            if (values.template has_external_value<P>())
+            {
+                std::string message{"to_argv() cannot render \""};
+                message += P::identifiers.front();
+                message += "\", its value is only held by the config struct of parse_into()";
+                throw std::logic_error(message);
+            }
+        }
+
+        if constexpr (CmdOption<P> && (StdArray<typename P::ValueType> || InlineVectorType<typename P::ValueType>))
+        {
+            const auto *value = effective_value<P>(values, overrides...);
+            if (value != nullptr && std::ranges::any_of(*value, [](const auto &element) { return formats_with_list_delimiter(element); }))
+            {
+                std::string message{"to_argv() cannot render \""};
+                message += P::identifiers.front();
+                message += "\", an element of its list contains '";
+                message += list_delimiter;
+                message += '\'';
+                throw std::invalid_argument(message);
+            }
+        }
+    };
+    (check_renderable.template operator()<Parsables>(), ...);
+
+    // Every Parsable is visited twice: first to measure, then to write, so
+    // the buffers can be allocated exactly once
+    const auto for_each_token = [&](const auto &emit)
+    {
+        emit(program.size(), [&program](char *out) { std::memcpy(out, program.data(), program.size()); });
+
+        (
+            [&]
+            {
+                const auto *value = effective_value<Parsables>(values, overrides...);
+                if (value == nullptr)
+                {
+                    return;
+                }
+
+                if constexpr (CmdFlag<Parsables>)
+                {
+                    if (!*value)
+                    {
+                        return;
+                    }
+                }
+
+                constexpr std::string_view identifier = Parsables::identifiers.front();
+                emit(identifier.size(), [identifier](char *out) { std::memcpy(out, identifier.data(), identifier.size()); });
+
+                if constexpr (CmdOption<Parsables>)
+                {
+                    emit(format_value(*value, nullptr), [value](char *out) { format_value(*value, out); });
+                }
+            }(),
+            ...);
+    };
+
+    std::size_t token_count     = 0;
+    std::size_t character_count = 0;
+    for_each_token(
+        [&](const std::size_t length, const auto &)
+        {
+            token_count += 1;
+            character_count += length + 1;
+        });
+
+    Argv argv{token_count, character_count, values.resource()};
+    for_each_token([&argv](const std::size_t length, const auto &write) { write(argv.append(length)); });
+    return argv;
+}
+
+#endif // CLARGS_ARGV_HPP
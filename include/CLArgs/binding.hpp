@@ -0,0 +1,81 @@
+#ifndef CLARGS_BINDING_HPP
+#define CLARGS_BINDING_HPP
+
+#include <CLArgs/core.hpp>
+
+#include <type_traits>
+
+namespace CLArgs
+{
+    template <auto Member>
+    struct MemberPointerTraits;
+
+    template <typename Class, typename T, T Class::*Member>
+    struct MemberPointerTraits<Member>
+    {
+        using Config = Class;
+        using Type   = T;
+    };
+
+    // Flag or option whose value is written straight into a member of a
+    // caller-provided struct by Parser::parse_into(), e.g.
+    //
+    //     using Threads = CLArgs::Bound<ThreadsOption, &Config::threads>;
+    //
+    // Parsed with Parser::parse(), a bound Parsable behaves like Member.
+    template <Parsable Member, auto Target>
+    struct Bound;
+
+    template <CmdFlag Member, auto Target>
+        requires(!CmdOption<Member>)
+    struct Bound<Member, Target>
+    {
+        static constexpr auto             identifiers{Member::identifiers};
+        static constexpr std::string_view description{Member::description};
+        static constexpr bool             terminating{TerminatingFlag<Member>};
+        static constexpr auto             target{Target};
+
+        using ValueType = bool;
+        using Config    = typename MemberPointerTraits<Target>::Config;
+
+        static_assert(std::is_same_v<typename MemberPointerTraits<Target>::Type, bool>, "Flags must be bound to a bool member");
+    };
+
+    template <CmdOption Member, auto Target>
+    struct Bound<Member, Target>
+    {
+        static constexpr auto             identifiers{Member::identifiers};
+        static constexpr std::string_view value_hint{Member::value_hint};
+        static constexpr std::string_view description{Member::description};
+        static constexpr auto             default_value{Member::default_value};
+        static constexpr auto             target{Target};
+
+        using ValueType = typename Member::ValueType;
+        using Config    = typename MemberPointerTraits<Target>::Config;
+
+        static_assert(std::is_same_v<typename MemberPointerTraits<Target>::Type, ValueType>,
+                      "Options must be bound to a member of their value type");
+    };
+
+    template <typename T>
+    concept BoundParsable = Parsable<T> && requires {
+        typename T::Config;
+        requires std::is_member_object_pointer_v<decltype(T::target)>;
+    };
+
+    template <typename Config, Parsable P>
+    struct BindsTo : std::true_type
+    {
+    };
+
+    template <typename Config, BoundParsable P>
+    struct BindsTo<Config, P> : std::is_same<typename P::Config, Config>
+    {
+    };
+
+    // Whether every bound Parsable among Parsables writes into a Config
+    template <typename Config, Parsable... Parsables>
+    inline constexpr bool binds_to_v = (BindsTo<Config, Parsables>::value && ...);
+} // namespace CLArgs
+
+#endif // CLARGS_BINDING_HPP
@@ -0,0 +1,244 @@
+#ifndef CLARGS_COMMAND_LINE_HPP
+#define CLARGS_COMMAND_LINE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+namespace CLArgs
+{
+    // Splits a single command-line string into tokens using POSIX shell
+    // quoting rules: whitespace separates tokens, single quotes preserve
+    // everything literally, double quotes preserve everything except
+    // backslash escapes of '"', '\', '$', '`' and newline, and an unquoted
+    // backslash escapes the following character.
+    //
+    // Tokens are produced lazily and unquoted into the caller-supplied
+    // buffer, which must be at least as large as the command line. The
+    // returned string_views point into that buffer.
+    class CommandLineTokenizer : public std::ranges::view_interface<CommandLineTokenizer>
+    {
+    public:
+        class Iterator;
+
+        CommandLineTokenizer() noexcept = default;
+        CommandLineTokenizer(std::string_view command_line, std::span<char> buffer);
+
+        [[nodiscard]] Iterator                begin() const;
+        [[nodiscard]] std::default_sentinel_t end() const noexcept;
+
+    private:
+        std::string_view command_line_{};
+        char            *buffer_{};
+    };
+
+    class CommandLineTokenizer::Iterator
+    {
+    public:
+        using value_type       = std::string_view;
+        using difference_type  = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        Iterator() noexcept = default;
+        Iterator(std::string_view command_line, char *output);
+
+        [[nodiscard]] std::string_view operator*() const noexcept;
+
+        Iterator &operator++();
+        Iterator  operator++(int);
+
+        [[nodiscard]] bool operator==(const Iterator &other) const noexcept;
+        [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept;
+
+    private:
+        void read_token();
+
+        std::string_view command_line_{};
+        std::size_t      position_{};
+        char            *output_{};
+        std::string_view token_{};
+        bool             at_end_{true};
+    };
+} // namespace CLArgs
+
+// Iterators do not refer back to the tokenizer, so they remain valid after it is gone
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<CLArgs::CommandLineTokenizer> = true;
+
+inline CLArgs::CommandLineTokenizer::CommandLineTokenizer(const std::string_view command_line, const std::span<char> buffer)
+    : command_line_{command_line}
+    , buffer_{buffer.data()}
+{
+    if (buffer.size() < command_line.size())
+    {
+        throw std::invalid_argument("Command-line buffer must be at least as large as the command line");
+    }
+}
+
+inline CLArgs::CommandLineTokenizer::Iterator
+CLArgs::CommandLineTokenizer::begin() const
+{
+    return {command_line_, buffer_};
+}
+
+inline std::default_sentinel_t
+CLArgs::CommandLineTokenizer::end() const noexcept
+{
+    return std::default_sentinel;
+}
+
+inline CLArgs::CommandLineTokenizer::Iterator::Iterator(const std::string_view command_line, char *output)
+    : command_line_{command_line}
+    , output_{output}
+    , at_end_{false}
+{
+    read_token();
+}
+
+inline std::string_view
+CLArgs::CommandLineTokenizer::Iterator::operator*() const noexcept
+{
+    return token_;
+}
+
+inline CLArgs::CommandLineTokenizer::Iterator &
+CLArgs::CommandLineTokenizer::Iterator::operator++()
+{
+    read_token();
+    return *this;
+}
+
+inline CLArgs::CommandLineTokenizer::Iterator
+CLArgs::CommandLineTokenizer::Iterator::operator++(int)
+{
+    Iterator copy = *this;
+    read_token();
+    return copy;
+}
+
+inline bool
+CLArgs::CommandLineTokenizer::Iterator::operator==(const Iterator &other) const noexcept
+{
+    return at_end_ == other.at_end_ && position_ == other.position_;
+}
+
+inline bool
+CLArgs::CommandLineTokenizer::Iterator::operator==(std::default_sentinel_t) const noexcept
+{
+    return at_end_;
+}
+
+inline void
+CLArgs::CommandLineTokenizer::Iterator::read_token()
+{
+    const auto is_whitespace = [](const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+
+    while (position_ < command_line_.size() && is_whitespace(command_line_[position_]))
+    {
+        ++position_;
+    }
+
+    if (position_ == command_line_.size())
+    {
+        at_end_ = true;
+        token_  = {};
+        return;
+    }
+
+    // Unquoting never makes a token longer than its source, and tokens are
+    // written in order, so the output never overtakes the input position
+    char *const token_begin = output_;
+    char       *out         = output_;
+
+    enum class State
+    {
+        Unquoted,
+        SingleQuoted,
+        DoubleQuoted,
+    };
+    State state = State::Unquoted;
+
+    for (; position_ < command_line_.size(); ++position_)
+    {
+        const char c = command_line_[position_];
+
+        if (state == State::SingleQuoted)
+        {
+            if (c == '\'')
+            {
+                state = State::Unquoted;
+            }
+            else
+            {
+                *out++ = c;
+            }
+            continue;
+        }
+
+        if (c == '\\')
+        {
+            if (position_ + 1 == command_line_.size())
+            {
+                throw std::invalid_argument("Command line ends with an unfinished escape sequence");
+            }
+
+            const char escaped = command_line_[++position_];
+            if (escaped == '\n')
+            {
+                continue;
+            }
+
+            const bool escapable_in_double_quotes = escaped == '"' || escaped == '\\' || escaped == '$' || escaped == '`';
+            if (state == State::DoubleQuoted && !escapable_in_double_quotes)
+            {
+                *out++ = '\\';
+            }
+            *out++ = escaped;
+            continue;
+        }
+
+        if (state == State::DoubleQuoted)
+        {
+            if (c == '"')
+            {
+                state = State::Unquoted;
+            }
+            else
+            {
+                *out++ = c;
+            }
+            continue;
+        }
+
+        if (is_whitespace(c))
+        {
+            break;
+        }
+
+        if (c == '\'')
+        {
+            state = State::SingleQuoted;
+        }
+        else if (c == '"')
+        {
+            state = State::DoubleQuoted;
+        }
+        else
+        {
+            *out++ = c;
+        }
+    }
+
+    if (state != State::Unquoted)
+    {
+        throw std::invalid_argument("Command line contains an unterminated quote");
+    }
+
+    token_  = {token_begin, static_cast<std::size_t>(out - token_begin)};
+    output_ = out;
+}
+
+#endif // CLARGS_COMMAND_LINE_HPP
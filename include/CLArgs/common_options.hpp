@@ -2,6 +2,9 @@
 #define CLARGS_COMMON_OPTIONS_HPP
 
 #include <CLArgs/core.hpp>
+#include <CLArgs/cpu_set.hpp>
+#include <CLArgs/network.hpp>
+#include <CLArgs/thread_count.hpp>
 
 #include <chrono>
 #include <cstdint>
@@ -13,10 +16,12 @@ namespace CLArgs::CommonOptions
     using Config     = Option<"--configuration,--config", "<filepath>", "Specify the config file path", std::filesystem::path>;
     using Output     = Option<"--output,-o", "<filepath>", "Specify the output file path", std::filesystem::path>;
     using Input      = Option<"--input,-i", "<filepath>", "Specify the input file path", std::filesystem::path>;
-    using Timeout    = Option<"--timeout", "<seconds>", "Specify the timeout duration in seconds", std::chrono::seconds>;
-    using Ip         = Option<"--ip,--address", "<ip address>", "Specify the IP address", std::string>;
+    using Timeout    = Option<"--timeout", "<duration>", "Specify the timeout in seconds, or like 1m30s", std::chrono::duration<double>>;
+    using Ip         = Option<"--ip,--address", "<ip address>", "Specify the IPv4 or IPv6 address", IpAddress>;
     using Port       = Option<"--port", "<number>", "Specify the port number", std::uint16_t>;
-    using Threads    = Option<"--threads", "<number>", "Specify the number of threads", std::uint16_t>;
+    using Endpoint   = Option<"--endpoint", "<address:port>", "Specify the endpoint, like 127.0.0.1:80 or [::1]:80", CLArgs::Endpoint>;
+    using Threads    = Option<"--threads", "<number>", "Specify the number of threads, auto, or a multiple like 0.5x", ThreadCount>;
+    using Cpus       = Option<"--cpus", "<cpu list>", "Specify the CPUs to run on, like 0-3,8-11", CpuSet>;
     using Username   = Option<"--username,--user", "<username>", "Specify the username", std::string>;
     using Password   = Option<"--password,--pass", "<password>", "Specify the password", std::string>;
     using MaxRetries = Option<"--max-retries", "<number>", "Specify the maximum number of retries", std::uint32_t>;
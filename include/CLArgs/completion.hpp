@@ -0,0 +1,146 @@
+#ifndef CLARGS_COMPLETION_HPP
+#define CLARGS_COMPLETION_HPP
+
+#include <CLArgs/core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace CLArgs
+{
+    inline constexpr std::string_view completion_request_identifier{"--__complete"};
+
+    template <Parsable... Parsables>
+    [[nodiscard]] consteval std::size_t total_identifier_count();
+
+    template <Parsable... Parsables>
+    [[nodiscard]] consteval auto sorted_identifier_table();
+
+    template <std::size_t N>
+    [[nodiscard]] constexpr std::span<const std::string_view> complete(const std::array<std::string_view, N> &sorted_table,
+                                                                       std::string_view                      partial) noexcept;
+
+    [[nodiscard]] inline std::string bash_completion_script(std::string_view program);
+    [[nodiscard]] inline std::string zsh_completion_script(std::string_view program);
+
+    [[nodiscard]] inline std::string completion_function_name(std::string_view program);
+
+    // Single-quotes text for a POSIX shell, so nothing in it is expanded
+    [[nodiscard]] inline std::string shell_quote(std::string_view text);
+} // namespace CLArgs
+
+template <CLArgs::Parsable... Parsables>
+consteval std::size_t
+CLArgs::total_identifier_count()
+{
+    return (std::size_t{0} + ... + Parsables::identifiers.size());
+}
+
+template <CLArgs::Parsable... Parsables>
+consteval auto
+CLArgs::sorted_identifier_table()
+{
+    std::array<std::string_view, total_identifier_count<Parsables...>()> table{};
+
+    auto iter = table.begin();
+    ((iter = std::ranges::copy(Parsables::identifiers, iter).out), ...);
+
+    std::ranges::sort(table);
+    return table;
+}
+
+template <std::size_t N>
+constexpr std::span<const std::string_view>
+CLArgs::complete(const std::array<std::string_view, N> &sorted_table, const std::string_view partial) noexcept
+{
+    // All identifiers sharing a prefix are contiguous in a sorted table, so two
+    // binary searches bound the answer without touching non-matching entries
+    const auto first = std::ranges::lower_bound(sorted_table, partial);
+    const auto last  = std::partition_point(first,
+                                           sorted_table.end(),
+                                           [partial](const std::string_view identifier) { return identifier.starts_with(partial); });
+
+    return {first, last};
+}
+
+inline std::string
+CLArgs::completion_function_name(std::string_view program)
+{
+    if (const auto slash = program.find_last_of("/\\"); slash != std::string_view::npos)
+    {
+        program.remove_prefix(slash + 1);
+    }
+
+    std::string name{"_clargs_complete_"};
+    std::ranges::transform(program,
+                           std::back_inserter(name),
+                           [](const char c)
+                           {
+                               const bool is_alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+                               return is_alnum ? c : '_';
+                           });
+    return name;
+}
+
+inline std::string
+CLArgs::shell_quote(const std::string_view text)
+{
+    // A single quote cannot appear inside single quotes, so it closes the
+    // quoted string, is escaped, and a new quoted string is opened
+    std::string quoted{"'"};
+    for (const char c : text)
+    {
+        if (c == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted += c;
+        }
+    }
+    quoted += '\'';
+    return quoted;
+}
+
+inline std::string
+CLArgs::bash_completion_script(const std::string_view program)
+{
+    const std::string function_name  = completion_function_name(program);
+    const std::string quoted_program = shell_quote(program);
+
+    std::string script;
+    script += function_name + "()\n";
+    script += "{\n";
+    script += "    local cur=\"${COMP_WORDS[COMP_CWORD]}\"\n";
+    script += "    mapfile -t COMPREPLY < <(" + quoted_program + " " + std::string(completion_request_identifier) +
+              " \"$cur\" 2>/dev/null)\n";
+    script += "}\n";
+    script += "complete -o default -F " + function_name + " " + quoted_program + "\n";
+    return script;
+}
+
+inline std::string
+CLArgs::zsh_completion_script(const std::string_view program)
+{
+    const std::string function_name  = completion_function_name(program);
+    const std::string quoted_program = shell_quote(program);
+
+    std::string script;
+    script += function_name + "()\n";
+    script += "{\n";
+    script += "    local -a candidates\n";
+    script += "    candidates=(${(f)\"$(" + quoted_program + " " + std::string(completion_request_identifier) +
+              " \"${words[CURRENT]}\" 2>/dev/null)\"})\n";
+    script += "    compadd -a candidates\n";
+    script += "}\n";
+    script += "compdef " + function_name + " " + quoted_program + "\n";
+    return script;
+}
+
+#endif // CLARGS_COMPLETION_HPP
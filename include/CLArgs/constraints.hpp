@@ -0,0 +1,242 @@
+#ifndef CLARGS_CONSTRAINTS_HPP
+#define CLARGS_CONSTRAINTS_HPP
+
+#include <CLArgs/core.hpp>
+#include <CLArgs/value_container.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CLArgs
+{
+    enum class ConstraintKind
+    {
+        Required,     // All members must be given
+        ExactlyOneOf, // One member must be given, and no other
+        AtMostOneOf,  // Members exclude each other
+        AtLeastOneOf, // Any number of members, but not none
+        Requires,     // If the first member is given, all others must be
+    };
+
+    // A rule over which flags and options were given on the command line.
+    // The members are turned into masks over the presence bits of the
+    // parser's ValueContainer at compile time, so checking a rule after
+    // parsing only takes a few bitwise operations.
+    template <ConstraintKind Kind, Parsable... Members>
+    struct Constraint
+    {
+        static_assert(sizeof...(Members) > (Kind == ConstraintKind::Requires ? 1 : 0), "Constraint has too few members");
+        static_assert(all_unique_v<Members...>, "Constraint members must be unique");
+
+        static constexpr ConstraintKind kind{Kind};
+    };
+
+    template <Parsable... Members>
+    using Required = Constraint<ConstraintKind::Required, Members...>;
+
+    template <Parsable... Members>
+    using ExactlyOneOf = Constraint<ConstraintKind::ExactlyOneOf, Members...>;
+
+    template <Parsable... Members>
+    using MutuallyExclusive = Constraint<ConstraintKind::AtMostOneOf, Members...>;
+
+    template <Parsable... Members>
+    using AtLeastOneOf = Constraint<ConstraintKind::AtLeastOneOf, Members...>;
+
+    template <Parsable Dependent, Parsable... Dependencies>
+    using Requires = Constraint<ConstraintKind::Requires, Dependent, Dependencies...>;
+
+    template <typename... Constraints>
+    struct ConstraintList
+    {
+    };
+
+    template <typename T>
+    struct is_constraint : std::false_type
+    {
+    };
+
+    template <ConstraintKind Kind, Parsable... Members>
+    struct is_constraint<Constraint<Kind, Members...>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    concept ParserConstraint = is_constraint<T>::value;
+
+    // Whether all members of constraint C are part of Parsables
+    template <typename C, Parsable... Parsables>
+    struct constraint_members_part_of;
+
+    template <ConstraintKind Kind, Parsable... Members, Parsable... Parsables>
+    struct constraint_members_part_of<Constraint<Kind, Members...>, Parsables...>
+        : std::bool_constant<(is_part_of_v<Members, Parsables...> && ...)>
+    {
+    };
+
+    template <typename C, Parsable... Parsables>
+    inline constexpr bool constraint_members_part_of_v = constraint_members_part_of<C, Parsables...>::value;
+
+    template <typename C, typename Container>
+    struct ConstraintChecker;
+
+    template <ConstraintKind Kind, Parsable Dependent, Parsable... Others, Parsable... Parsables>
+    struct ConstraintChecker<Constraint<Kind, Dependent, Others...>, ValueContainer<Parsables...>>
+    {
+        using Container = ValueContainer<Parsables...>;
+
+        [[nodiscard]] static constexpr bool is_satisfied(const typename Container::PresenceBits &presence) noexcept;
+
+        // Describes how the constraint is violated, for the error message
+        [[nodiscard]] static std::string describe(const Container &values);
+
+    private:
+        static constexpr auto members_mask_{Container::template presence_mask<Dependent, Others...>()};
+        static constexpr auto dependent_mask_{Container::template presence_mask<Dependent>()};
+        static constexpr auto dependencies_mask_{Container::template presence_mask<Others...>()};
+    };
+
+    // Throws std::invalid_argument describing the first violated constraint
+    template <ParserConstraint... Constraints, Parsable... Parsables>
+    void check_constraints(const ValueContainer<Parsables...> &values);
+} // namespace CLArgs
+
+template <CLArgs::ConstraintKind Kind, CLArgs::Parsable Dependent, CLArgs::Parsable... Others, CLArgs::Parsable... Parsables>
+constexpr bool
+CLArgs::ConstraintChecker<CLArgs::Constraint<Kind, Dependent, Others...>, CLArgs::ValueContainer<Parsables...>>::is_satisfied(
+    const typename Container::PresenceBits &presence) noexcept
+{
+    if constexpr (Kind == ConstraintKind::Requires)
+    {
+        bool dependent_given    = false;
+        bool dependencies_given = true;
+        for (std::size_t word = 0; word < Container::presence_words; ++word)
+        {
+            dependent_given |= (presence[word] & dependent_mask_[word]) != 0;
+            dependencies_given &= (presence[word] & dependencies_mask_[word]) == dependencies_mask_[word];
+        }
+        return !dependent_given || dependencies_given;
+    }
+    else
+    {
+        int  given     = 0;
+        bool all_given = true;
+        for (std::size_t word = 0; word < Container::presence_words; ++word)
+        {
+            const std::uint64_t present = presence[word] & members_mask_[word];
+            given += std::popcount(present);
+            all_given &= present == members_mask_[word];
+        }
+
+        switch (Kind)
+        {
+        case ConstraintKind::Required:
+            return all_given;
+        case ConstraintKind::ExactlyOneOf:
+            return given == 1;
+        case ConstraintKind::AtMostOneOf:
+            return given <= 1;
+        case ConstraintKind::AtLeastOneOf:
+            return given >= 1;
+        default:
+            return true;
+        }
+    }
+}
+
+template <CLArgs::ConstraintKind Kind, CLArgs::Parsable Dependent, CLArgs::Parsable... Others, CLArgs::Parsable... Parsables>
+std::string
+CLArgs::ConstraintChecker<CLArgs::Constraint<Kind, Dependent, Others...>, CLArgs::ValueContainer<Parsables...>>::describe(
+    const Container &values)
+{
+    std::stringstream ss;
+
+    const auto list_members = [&ss, &values](const bool only_given)
+    {
+        bool       first = true;
+        const auto list  = [&]<Parsable Member>()
+        {
+            if (!only_given || values.template is_set<Member>())
+            {
+                ss << (first ? "\"" : ", \"") << Member::identifiers[0] << '"';
+                first = false;
+            }
+        };
+        list.template operator()<Dependent>();
+        (list.template operator()<Others>(), ...);
+    };
+
+    const auto list_missing = [&ss, &values]
+    {
+        bool       first = true;
+        const auto list  = [&]<Parsable Member>()
+        {
+            if (!values.template is_set<Member>())
+            {
+                ss << (first ? "\"" : ", \"") << Member::identifiers[0] << '"';
+                first = false;
+            }
+        };
+        if constexpr (Kind != ConstraintKind::Requires)
+        {
+            list.template operator()<Dependent>();
+        }
+        (list.template operator()<Others>(), ...);
+    };
+
+    const bool any_given = values.template is_set<Dependent>() || (values.template is_set<Others>() || ...);
+
+    if constexpr (Kind == ConstraintKind::Required)
+    {
+        ss << "Missing required argument ";
+        list_missing();
+    }
+    else if constexpr (Kind == ConstraintKind::Requires)
+    {
+        ss << "Argument \"" << Dependent::identifiers[0] << "\" requires ";
+        list_missing();
+    }
+    else if (!any_given)
+    {
+        ss << (Kind == ConstraintKind::ExactlyOneOf ? "Expected one of " : "Expected at least one of ");
+        list_members(false);
+    }
+    else
+    {
+        ss << "Arguments ";
+        list_members(true);
+        ss << " cannot be combined";
+    }
+
+    return ss.str();
+}
+
+template <CLArgs::ParserConstraint... Constraints, CLArgs::Parsable... Parsables>
+void
+CLArgs::check_constraints(const ValueContainer<Parsables...> &values)
+{
+    static_assert((constraint_members_part_of_v<Constraints, Parsables...> && ...), "Constraint refers to an unknown flag or option");
+
+    const auto &presence = values.presence();
+
+    // Every check is a handful of AND and compare instructions, the message
+    // is only built for the constraint that failed
+    (
+        [&]
+        {
+            using Checker = ConstraintChecker<Constraints, ValueContainer<Parsables...>>;
+            if (!Checker::is_satisfied(presence))
+            {
+                throw std::invalid_argument(Checker::describe(values));
+            }
+        }(),
+        ...);
+}
+
+#endif // CLARGS_CONSTRAINTS_HPP
@@ -5,12 +5,20 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <memory>
 #include <ranges>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 
 namespace CLArgs
 {
+    inline constexpr std::string_view end_of_options_identifier{"--"};
+
+    // Fixed rather than std::hardware_destructive_interference_size, whose
+    // value may differ between translation units and compiler flags
+    inline constexpr std::size_t cache_line_size{64};
+
     template <std::size_t N>
     struct StringLiteral
     {
@@ -19,9 +27,41 @@ namespace CLArgs
         char value[N]{};
     };
 
+    template <typename T>
+    struct IsStringLiteral : std::false_type
+    {
+    };
+
+    template <std::size_t N>
+    struct IsStringLiteral<StringLiteral<N>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_string_literal_v = IsStringLiteral<T>::value;
+
     template <StringLiteral str, char delimiter = ','>
     [[nodiscard]] consteval auto array_from_delimited_string();
 
+    struct NoDefaultValue
+    {
+    };
+
+    template <typename T>
+    struct DefaultValue
+    {
+        constexpr DefaultValue(T val); // NOLINT(google-explicit-constructor)
+
+        template <std::size_t N>
+        constexpr DefaultValue(const char (&str)[N]) // NOLINT(google-explicit-constructor)
+            requires std::is_same_v<T, StringLiteral<N>>;
+
+        T value;
+    };
+
+    template <std::size_t N>
+    DefaultValue(const char (&)[N]) -> DefaultValue<StringLiteral<N>>;
+
     template <typename T>
     concept CmdFlag = requires {
         { T::identifiers } -> std::convertible_to<std::array<std::string_view, std::tuple_size_v<decltype(T::identifiers)>>>;
@@ -31,17 +71,31 @@ namespace CLArgs
         requires std::is_same_v<typename T::ValueType, bool>;
     };
 
-    template <const StringLiteral Identifiers, const StringLiteral Description>
+    enum class FlagBehavior
+    {
+        Default,
+        Terminating,
+    };
+
+    template <const StringLiteral Identifiers, const StringLiteral Description, FlagBehavior Behavior = FlagBehavior::Default>
     struct Flag
     {
         static constexpr auto             identifiers{array_from_delimited_string<Identifiers>()};
         static constexpr std::string_view description{Description.value};
+        static constexpr bool             terminating{Behavior == FlagBehavior::Terminating};
 
         using ValueType = bool;
 
         static_assert(identifiers.size() >= 1, "Must have at least one identifier");
     };
 
+    // A terminating flag ends parsing as soon as it is seen, leaving every
+    // other argument unparsed. Intended for flags like --help and --version.
+    template <typename T>
+    concept TerminatingFlag = CmdFlag<T> && requires {
+        requires T::terminating;
+    };
+
     template <typename T>
     concept CmdOption = requires {
         { T::identifiers } -> std::convertible_to<std::array<std::string_view, std::tuple_size_v<decltype(T::identifiers)>>>;
@@ -50,17 +104,38 @@ namespace CLArgs
         typename T::ValueType;
     };
 
-    template <const StringLiteral Identifiers, const StringLiteral ValueHint, const StringLiteral Description, typename ValType>
+    // Default is either a value ValType can be constructed from, or a string
+    // literal for string-like value types, e.g. "localhost"
+    template <const StringLiteral Identifiers,
+              const StringLiteral ValueHint,
+              const StringLiteral Description,
+              typename ValType,
+              const DefaultValue Default = NoDefaultValue{}>
     struct Option
     {
         static constexpr auto             identifiers{array_from_delimited_string<Identifiers>()};
         static constexpr std::string_view value_hint{ValueHint.value};
         static constexpr std::string_view description{Description.value};
+        static constexpr auto             default_value{Default.value};
         using ValueType = ValType;
 
         static_assert(identifiers.size() >= 1, "Must have at least one identifier");
+        static_assert(std::is_same_v<std::remove_cv_t<decltype(default_value)>, NoDefaultValue> ||
+                          std::is_constructible_v<ValType, decltype(default_value)> ||
+                          (is_string_literal_v<std::remove_cv_t<decltype(default_value)>> &&
+                           std::is_constructible_v<ValType, std::string_view>),
+                      "Default value must be convertible to the value type of the option");
+    };
+
+    template <typename T>
+    concept CmdOptionWithDefault = CmdOption<T> && requires {
+        T::default_value;
+        requires !std::is_same_v<std::remove_cv_t<decltype(T::default_value)>, NoDefaultValue>;
     };
 
+    template <CmdOptionWithDefault Option, typename Allocator>
+    [[nodiscard]] typename Option::ValueType make_default_value(const Allocator &allocator);
+
     template <CmdFlag... Flags>
     using CmdFlagList = std::tuple<Flags...>;
 
@@ -118,6 +193,9 @@ namespace CLArgs
     template <typename T>
     concept Parsable = CmdFlag<T> || CmdOption<T>;
 
+    template <typename R>
+    concept ArgumentRange = std::ranges::forward_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>;
+
     template <typename T, typename... Ts>
     struct IsPartOf : std::disjunction<std::is_same<T, Ts>...>
     {
@@ -221,6 +299,36 @@ CLArgs::array_from_delimited_string()
     return result;
 }
 
+template <typename T>
+constexpr CLArgs::DefaultValue<T>::DefaultValue(T val)
+    : value{val}
+{
+}
+
+template <typename T>
+template <std::size_t N>
+constexpr CLArgs::DefaultValue<T>::DefaultValue(const char (&str)[N])
+    requires std::is_same_v<T, StringLiteral<N>>
+    : value{str}
+{
+}
+
+template <CLArgs::CmdOptionWithDefault Option, typename Allocator>
+typename Option::ValueType
+CLArgs::make_default_value(const Allocator &allocator)
+{
+    // Allocator-aware value types are constructed directly with the allocator,
+    // other types ignore it
+    if constexpr (is_string_literal_v<std::remove_cv_t<decltype(Option::default_value)>>)
+    {
+        return std::make_obj_using_allocator<typename Option::ValueType>(allocator, std::string_view{Option::default_value.value});
+    }
+    else
+    {
+        return std::make_obj_using_allocator<typename Option::ValueType>(allocator, Option::default_value);
+    }
+}
+
 template <CLArgs::Parsable Parsable>
 consteval std::size_t
 CLArgs::identifier_list_length()
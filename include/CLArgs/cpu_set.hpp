@@ -0,0 +1,351 @@
+#ifndef CLARGS_CPU_SET_HPP
+#define CLARGS_CPU_SET_HPP
+
+#include <CLArgs/value_traits.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace CLArgs
+{
+    // A set of CPU numbers, with the same capacity as a glibc cpu_set_t
+    struct CpuSet
+    {
+        static constexpr std::size_t max_cpus{1024};
+
+        std::array<std::uint64_t, max_cpus / 64> words{};
+
+        constexpr void set(std::size_t cpu) noexcept;
+        constexpr void reset(std::size_t cpu) noexcept;
+
+        [[nodiscard]] constexpr bool        test(std::size_t cpu) const noexcept;
+        [[nodiscard]] constexpr std::size_t count() const noexcept;
+        [[nodiscard]] constexpr bool        empty() const noexcept;
+        [[nodiscard]] constexpr bool        is_subset_of(const CpuSet &other) const noexcept;
+
+#if defined(__linux__)
+        [[nodiscard]] cpu_set_t     to_cpu_set_t() const noexcept;
+        [[nodiscard]] static CpuSet from_cpu_set_t(const cpu_set_t &set) noexcept;
+#endif
+
+        constexpr bool operator==(const CpuSet &) const = default;
+    };
+
+    // Parses the cpulist syntax of Linux, a comma separated list of groups
+    // like "3", "0-7", "0-31:2" for every second CPU, or "0-31:2/8" for the
+    // first two CPUs of every eight. With allowed, every CPU must also be in
+    // allowed, and errors point at the group that named a CPU that is not.
+    [[nodiscard]] constexpr ValueParseResult parse_cpu_list(std::string_view sv, CpuSet &out, const CpuSet *allowed = nullptr) noexcept;
+
+    // Writes set in cpulist syntax with ranges, like "0-3,8-11,16", and
+    // returns the number of characters written. With out == nullptr nothing
+    // is written, and only the length is returned.
+    constexpr std::size_t format_cpu_list(const CpuSet &set, char *out) noexcept;
+
+    // The CPUs the process may run on, or nothing where there is no affinity
+    // mask or it does not fit a CpuSet
+    [[nodiscard]] inline std::optional<CpuSet> affinity_cpu_set() noexcept;
+
+    // CPU lists given on the command line must name CPUs of the affinity
+    // mask, so a wrong list fails while parsing, not when pinning threads
+    template <>
+    struct ValueTraits<CpuSet>
+    {
+        static constexpr std::string_view name{"CPU list"};
+
+        static ValueParseResult parse(std::string_view sv, CpuSet &out) noexcept;
+    };
+} // namespace CLArgs
+
+constexpr void
+CLArgs::CpuSet::set(const std::size_t cpu) noexcept
+{
+    words[cpu / 64] |= std::uint64_t{1} << (cpu % 64);
+}
+
+constexpr void
+CLArgs::CpuSet::reset(const std::size_t cpu) noexcept
+{
+    words[cpu / 64] &= ~(std::uint64_t{1} << (cpu % 64));
+}
+
+constexpr bool
+CLArgs::CpuSet::test(const std::size_t cpu) const noexcept
+{
+    return cpu < max_cpus && (words[cpu / 64] & (std::uint64_t{1} << (cpu % 64))) != 0;
+}
+
+constexpr std::size_t
+CLArgs::CpuSet::count() const noexcept
+{
+    std::size_t result = 0;
+    for (const std::uint64_t word : words)
+    {
+        result += static_cast<std::size_t>(std::popcount(word));
+    }
+    return result;
+}
+
+constexpr bool
+CLArgs::CpuSet::empty() const noexcept
+{
+    for (const std::uint64_t word : words)
+    {
+        if (word != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool
+CLArgs::CpuSet::is_subset_of(const CpuSet &other) const noexcept
+{
+    for (std::size_t i = 0; i < words.size(); ++i)
+    {
+        if ((words[i] & ~other.words[i]) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(__linux__)
+inline cpu_set_t
+CLArgs::CpuSet::to_cpu_set_t() const noexcept
+{
+    cpu_set_t result;
+    CPU_ZERO(&result);
+    for (std::size_t cpu = 0; cpu < max_cpus && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (test(cpu))
+        {
+            CPU_SET(cpu, &result);
+        }
+    }
+    return result;
+}
+
+inline CLArgs::CpuSet
+CLArgs::CpuSet::from_cpu_set_t(const cpu_set_t &set) noexcept
+{
+    CpuSet result;
+    for (std::size_t cpu = 0; cpu < max_cpus && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set))
+        {
+            result.set(cpu);
+        }
+    }
+    return result;
+}
+#endif
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_cpu_list(const std::string_view sv, CpuSet &out, const CpuSet *allowed) noexcept
+{
+    std::size_t offset = 0;
+
+    // CPU numbers have at most four digits, so one more is out of range
+    // without overflowing
+    const auto read_number = [&sv, &offset](std::size_t &value) -> ValueParseResult
+    {
+        const std::size_t start = offset;
+        value                   = 0;
+        while (offset < sv.size() && offset - start < 5 && sv[offset] >= '0' && sv[offset] <= '9')
+        {
+            value = value * 10 + static_cast<std::size_t>(sv[offset] - '0');
+            ++offset;
+        }
+
+        if (offset == start)
+        {
+            return {ParseStatus::InvalidFormat, offset, "Expected a CPU number"};
+        }
+        if (value >= CpuSet::max_cpus)
+        {
+            return {ParseStatus::OutOfRange, start, "CPU number must be below 1024"};
+        }
+        return {};
+    };
+
+    out = CpuSet{};
+
+    while (true)
+    {
+        const std::size_t group_start = offset;
+
+        std::size_t first{};
+        if (const ValueParseResult result = read_number(first); !result)
+        {
+            return result;
+        }
+
+        std::size_t last       = first;
+        std::size_t used_size  = 1;
+        std::size_t group_size = 1;
+
+        if (offset < sv.size() && sv[offset] == '-')
+        {
+            ++offset;
+            if (const ValueParseResult result = read_number(last); !result)
+            {
+                return result;
+            }
+            if (last < first)
+            {
+                return {ParseStatus::InvalidFormat, group_start, "Range ends before it starts"};
+            }
+
+            // ":stride", or ":used/group" for the first used CPUs of every group
+            if (offset < sv.size() && sv[offset] == ':')
+            {
+                ++offset;
+                const std::size_t stride_start = offset;
+                if (const ValueParseResult result = read_number(group_size); !result)
+                {
+                    return result;
+                }
+
+                if (offset < sv.size() && sv[offset] == '/')
+                {
+                    ++offset;
+                    used_size = group_size;
+                    if (const ValueParseResult result = read_number(group_size); !result)
+                    {
+                        return result;
+                    }
+                }
+
+                if (used_size == 0 || group_size == 0)
+                {
+                    return {ParseStatus::InvalidFormat, stride_start, "Stride must be at least 1"};
+                }
+                if (used_size > group_size)
+                {
+                    return {ParseStatus::InvalidFormat, stride_start, "Cannot use more CPUs than the group has"};
+                }
+            }
+        }
+
+        for (std::size_t cpu = first; cpu <= last; cpu += group_size)
+        {
+            for (std::size_t used = 0; used < used_size && cpu + used <= last; ++used)
+            {
+                if (allowed != nullptr && !allowed->test(cpu + used))
+                {
+                    return {ParseStatus::OutOfRange, group_start, "CPU is not in the affinity mask of the process"};
+                }
+                out.set(cpu + used);
+            }
+        }
+
+        if (offset == sv.size())
+        {
+            return {};
+        }
+        if (sv[offset] != ',')
+        {
+            return {ParseStatus::InvalidFormat, offset, "Unexpected character"};
+        }
+        ++offset;
+    }
+}
+
+constexpr std::size_t
+CLArgs::format_cpu_list(const CpuSet &set, char *out) noexcept
+{
+    std::size_t length = 0;
+
+    const auto append_number = [out, &length](std::size_t value)
+    {
+        std::array<char, 4> digits{};
+        std::size_t         count = 0;
+        do
+        {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        while (count > 0)
+        {
+            const char digit = digits[--count];
+            if (out != nullptr)
+            {
+                out[length] = digit;
+            }
+            ++length;
+        }
+    };
+
+    const auto append_char = [out, &length](const char c)
+    {
+        if (out != nullptr)
+        {
+            out[length] = c;
+        }
+        ++length;
+    };
+
+    for (std::size_t cpu = 0; cpu < CpuSet::max_cpus; ++cpu)
+    {
+        if (!set.test(cpu))
+        {
+            continue;
+        }
+
+        std::size_t last = cpu;
+        while (set.test(last + 1))
+        {
+            ++last;
+        }
+
+        if (length > 0)
+        {
+            append_char(',');
+        }
+        append_number(cpu);
+        if (last > cpu)
+        {
+            append_char('-');
+            append_number(last);
+        }
+        cpu = last;
+    }
+
+    return length;
+}
+
+inline std::optional<CLArgs::CpuSet>
+CLArgs::affinity_cpu_set() noexcept
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0)
+    {
+        return CpuSet::from_cpu_set_t(set);
+    }
+#endif
+
+    return std::nullopt;
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::CpuSet>::parse(const std::string_view sv, CpuSet &out) noexcept
+{
+    const std::optional<CpuSet> allowed = affinity_cpu_set();
+    return parse_cpu_list(sv, out, allowed ? &*allowed : nullptr);
+}
+
+#endif // CLARGS_CPU_SET_HPP
@@ -0,0 +1,200 @@
+#ifndef CLARGS_FORMAT_VALUE_HPP
+#define CLARGS_FORMAT_VALUE_HPP
+
+#include <CLArgs/cpu_set.hpp>
+#include <CLArgs/network.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/thread_count.hpp>
+
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace CLArgs
+{
+    template <typename T>
+    concept FormattableScalarValue = std::is_arithmetic_v<T> || StdChronoDuration<T> || std::is_same_v<T, std::string> ||
+                                     std::is_same_v<T, std::pmr::string> || std::is_same_v<T, std::string_view> ||
+                                     std::is_same_v<T, std::filesystem::path> || std::is_same_v<T, ByteSize> ||
+                                     std::is_same_v<T, Rate> || std::is_same_v<T, ThreadCount> || std::is_same_v<T, CpuSet> ||
+                                     NetworkValue<T>;
+
+    // Lists are written with list_delimiter between their elements
+    template <typename T>
+    concept FormattableValue =
+        FormattableScalarValue<T> || ((StdArray<T> || InlineVectorType<T>) && FormattableScalarValue<typename T::value_type>);
+
+    // Writes value in a form that parse_value<T>() reads back and returns the
+    // number of characters written. With out == nullptr nothing is written,
+    // and only the length is returned.
+    template <FormattableValue T>
+    std::size_t format_value(const T &value, char *out) noexcept;
+
+    // Whether format_value() writes list_delimiter for value, so that as an
+    // element of a list it would be parsed back as more than one element
+    template <FormattableScalarValue T>
+    [[nodiscard]] bool formats_with_list_delimiter(const T &value) noexcept;
+} // namespace CLArgs
+
+template <CLArgs::FormattableValue T>
+std::size_t
+CLArgs::format_value(const T &value, char *out) noexcept
+{
+    const auto copy = [out](const char *chars, const std::size_t length)
+    {
+        if (out != nullptr)
+        {
+            std::memcpy(out, chars, length);
+        }
+        return length;
+    };
+
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return value ? copy("true", 4) : copy("false", 5);
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        return copy(&value, 1);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        // Large enough for the shortest round-trip form of any arithmetic type
+        std::array<char, 128> scratch{};
+        const auto [end, ec] = std::to_chars(scratch.data(), scratch.data() + scratch.size(), value);
+        return ec == std::errc{} ? copy(scratch.data(), static_cast<std::size_t>(end - scratch.data())) : 0;
+    }
+    else if constexpr (StdChronoDuration<T>)
+    {
+        return format_value(value.count(), out);
+    }
+    else if constexpr (std::is_same_v<T, ByteSize>)
+    {
+        return format_value(value.bytes, out);
+    }
+    else if constexpr (std::is_same_v<T, Rate>)
+    {
+        // Written in nanoseconds, as "count/<nanoseconds>ns", which every period is a whole number of
+        std::size_t length = format_value(value.count, out);
+        const auto  append = [out, &length](const std::string_view chars)
+        {
+            if (out != nullptr)
+            {
+                std::memcpy(out + length, chars.data(), chars.size());
+            }
+            length += chars.size();
+        };
+
+        append("/");
+        length += format_value(value.period_nanoseconds, out == nullptr ? nullptr : out + length);
+        append("ns");
+        return length;
+    }
+    else if constexpr (std::is_same_v<T, ThreadCount>)
+    {
+        if (!value.is_relative())
+        {
+            return format_value(value.count, out);
+        }
+        if (value.cpu_multiplier == 1.0)
+        {
+            return copy("auto", 4);
+        }
+
+        const std::size_t length = format_value(value.cpu_multiplier, out);
+        if (out != nullptr)
+        {
+            out[length] = 'x';
+        }
+        return length + 1;
+    }
+    else if constexpr (std::is_same_v<T, CpuSet>)
+    {
+        return format_cpu_list(value, out);
+    }
+    else if constexpr (NetworkValue<T>)
+    {
+        std::array<char, max_network_value_length> scratch{};
+        const char                                 *end = write_address(value, scratch.data());
+        return copy(scratch.data(), static_cast<std::size_t>(end - scratch.data()));
+    }
+    else if constexpr (StdArray<T> || InlineVectorType<T>)
+    {
+        std::size_t length = 0;
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            if (it != value.begin())
+            {
+                if (out != nullptr)
+                {
+                    out[length] = list_delimiter;
+                }
+                length += 1;
+            }
+            length += format_value(*it, out == nullptr ? nullptr : out + length);
+        }
+        return length;
+    }
+    else if constexpr (std::is_same_v<T, std::filesystem::path>)
+    {
+        if constexpr (std::is_same_v<std::filesystem::path::value_type, char>)
+        {
+            return copy(value.native().data(), value.native().size());
+        }
+        else
+        {
+            const std::string converted = value.string();
+            return copy(converted.data(), converted.size());
+        }
+    }
+    else
+    {
+        return copy(value.data(), value.size());
+    }
+}
+
+template <CLArgs::FormattableScalarValue T>
+bool
+CLArgs::formats_with_list_delimiter(const T &value) noexcept
+{
+    if constexpr (std::is_same_v<T, char>)
+    {
+        return value == list_delimiter;
+    }
+    else if constexpr (std::is_same_v<T, CpuSet>)
+    {
+        // Ranges of consecutive CPUs are separated by list_delimiter
+        std::size_t ranges = 0;
+        for (std::size_t cpu = 0; cpu < CpuSet::max_cpus; ++cpu)
+        {
+            if (value.test(cpu) && (cpu == 0 || !value.test(cpu - 1)))
+            {
+                ++ranges;
+            }
+        }
+        return ranges > 1;
+    }
+    else if constexpr (std::is_same_v<T, std::filesystem::path>)
+    {
+        using Char = std::filesystem::path::value_type;
+        return value.native().find(static_cast<Char>(list_delimiter)) != std::filesystem::path::string_type::npos;
+    }
+    else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+    {
+        return std::string_view{value}.find(list_delimiter) != std::string_view::npos;
+    }
+    else
+    {
+        // Numbers, durations, quantities and addresses never contain it
+        return false;
+    }
+}
+
+#endif // CLARGS_FORMAT_VALUE_HPP
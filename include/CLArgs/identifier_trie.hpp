@@ -0,0 +1,219 @@
+#ifndef CLARGS_IDENTIFIER_TRIE_HPP
+#define CLARGS_IDENTIFIER_TRIE_HPP
+
+#include <CLArgs/core.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace CLArgs
+{
+    // Prefix tree over the identifiers of a set of Parsables, used to find
+    // the Parsable of an argument and to expand abbreviated options. A lookup
+    // only walks the characters of the token once, so identifiers sharing a
+    // prefix like "--db.pool." do not compare it again for each of them.
+    // For abbreviations, every node of a long ("--name") identifier records
+    // which Parsable all identifiers below it belong to, or that they belong
+    // to several, so ambiguity is settled when the trie is built at compile
+    // time.
+    template <std::size_t NodeCapacity>
+    class IdentifierTrie
+    {
+    public:
+        static constexpr std::int32_t no_target{-1};
+        static constexpr std::int32_t ambiguous_target{-2};
+
+        constexpr void insert(std::string_view identifier, std::int32_t target);
+
+        // Returns the index of the Parsable with exactly this identifier, or
+        // no_target
+        [[nodiscard]] constexpr std::int32_t find(std::string_view identifier) const noexcept;
+
+        // Returns the index of the single Parsable whose identifiers start
+        // with prefix, no_target, or ambiguous_target
+        [[nodiscard]] constexpr std::int32_t find_prefix(std::string_view prefix) const noexcept;
+
+    private:
+        struct Node
+        {
+            char          character{};
+            std::uint32_t first_child{0}; // The root is never a child, so 0 means none
+            std::uint32_t next_sibling{0};
+            std::int32_t  target{no_target};       // Owner of the long identifiers below
+            std::int32_t  exact_target{no_target}; // Owner of the identifier ending here
+        };
+
+        [[nodiscard]] constexpr std::uint32_t find_child(std::uint32_t node, char c) const noexcept;
+
+        std::array<Node, NodeCapacity> nodes_{};
+        std::uint32_t                  size_{1};
+    };
+
+    [[nodiscard]] constexpr bool is_long_identifier(std::string_view identifier) noexcept;
+
+    template <Parsable... Parsables>
+    [[nodiscard]] consteval auto make_identifier_trie();
+
+    // The first long identifier of every Parsable, or its first identifier
+    // if it has none, in declaration order
+    template <Parsable... Parsables>
+    [[nodiscard]] consteval std::array<std::string_view, sizeof...(Parsables)> canonical_identifiers();
+} // namespace CLArgs
+
+template <std::size_t NodeCapacity>
+constexpr void
+CLArgs::IdentifierTrie<NodeCapacity>::insert(const std::string_view identifier, const std::int32_t target)
+{
+    const bool    abbreviable = is_long_identifier(identifier);
+    std::uint32_t node        = 0;
+
+    for (const char c : identifier)
+    {
+        std::uint32_t child = find_child(node, c);
+        if (child == 0)
+        {
+            child                      = size_++;
+            nodes_[child].character    = c;
+            nodes_[child].next_sibling = nodes_[node].first_child;
+            nodes_[node].first_child   = child;
+        }
+
+        node = child;
+
+        if (!abbreviable)
+        {
+            continue;
+        }
+
+        auto &node_target = nodes_[node].target;
+        if (node_target == no_target)
+        {
+            node_target = target;
+        }
+        else if (node_target != target)
+        {
+            node_target = ambiguous_target;
+        }
+    }
+
+    // Like a linear search, the first Parsable with an identifier wins
+    if (nodes_[node].exact_target == no_target)
+    {
+        nodes_[node].exact_target = target;
+    }
+}
+
+template <std::size_t NodeCapacity>
+constexpr std::int32_t
+CLArgs::IdentifierTrie<NodeCapacity>::find(const std::string_view identifier) const noexcept
+{
+    std::uint32_t node = 0;
+
+    for (const char c : identifier)
+    {
+        node = find_child(node, c);
+        if (node == 0)
+        {
+            return no_target;
+        }
+    }
+
+    return nodes_[node].exact_target;
+}
+
+template <std::size_t NodeCapacity>
+constexpr std::int32_t
+CLArgs::IdentifierTrie<NodeCapacity>::find_prefix(const std::string_view prefix) const noexcept
+{
+    std::uint32_t node = 0;
+
+    for (const char c : prefix)
+    {
+        node = find_child(node, c);
+        if (node == 0)
+        {
+            return no_target;
+        }
+    }
+
+    return node == 0 ? no_target : nodes_[node].target;
+}
+
+template <std::size_t NodeCapacity>
+constexpr std::uint32_t
+CLArgs::IdentifierTrie<NodeCapacity>::find_child(const std::uint32_t node, const char c) const noexcept
+{
+    for (std::uint32_t child = nodes_[node].first_child; child != 0; child = nodes_[child].next_sibling)
+    {
+        if (nodes_[child].character == c)
+        {
+            return child;
+        }
+    }
+    return 0;
+}
+
+constexpr bool
+CLArgs::is_long_identifier(const std::string_view identifier) noexcept
+{
+    return identifier.size() > 2 && identifier.starts_with("--");
+}
+
+template <CLArgs::Parsable... Parsables>
+consteval auto
+CLArgs::make_identifier_trie()
+{
+    constexpr std::size_t node_capacity = []
+    {
+        std::size_t characters = 1;
+        (
+            [&characters]
+            {
+                for (const std::string_view identifier : Parsables::identifiers)
+                {
+                    characters += identifier.size();
+                }
+            }(),
+            ...);
+        return characters;
+    }();
+
+    IdentifierTrie<node_capacity> trie;
+
+    std::int32_t target = 0;
+    (
+        [&trie, &target]
+        {
+            for (const std::string_view identifier : Parsables::identifiers)
+            {
+                trie.insert(identifier, target);
+            }
+            ++target;
+        }(),
+        ...);
+
+    return trie;
+}
+
+template <CLArgs::Parsable... Parsables>
+consteval std::array<std::string_view, sizeof...(Parsables)>
+CLArgs::canonical_identifiers()
+{
+    const auto canonical = []<Parsable P>()
+    {
+        for (const std::string_view identifier : P::identifiers)
+        {
+            if (is_long_identifier(identifier))
+            {
+                return identifier;
+            }
+        }
+        return P::identifiers.front();
+    };
+
+    return {canonical.template operator()<Parsables>()...};
+}
+
+#endif // CLARGS_IDENTIFIER_TRIE_HPP
@@ -0,0 +1,169 @@
+#ifndef CLARGS_INLINE_VECTOR_HPP
+#define CLARGS_INLINE_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace CLArgs
+{
+    // Vector with a fixed capacity and its elements stored inline, so it never
+    // allocates. Used for option values holding a delimited list, like
+    // "--ports 80,443,8080", when the number of elements is only bounded.
+    template <typename T, std::size_t Capacity>
+    class InlineVector
+    {
+    public:
+        using value_type     = T;
+        using size_type      = std::size_t;
+        using iterator       = T *;
+        using const_iterator = const T *;
+
+        static_assert(std::is_default_constructible_v<T>, "InlineVector requires a default constructible element type");
+
+        constexpr InlineVector() = default;
+
+        constexpr void push_back(const T &value);
+        constexpr void push_back(T &&value);
+        constexpr void clear() noexcept;
+
+        [[nodiscard]] constexpr T       &operator[](size_type index) noexcept;
+        [[nodiscard]] constexpr const T &operator[](size_type index) const noexcept;
+
+        [[nodiscard]] constexpr iterator       begin() noexcept;
+        [[nodiscard]] constexpr const_iterator begin() const noexcept;
+        [[nodiscard]] constexpr iterator       end() noexcept;
+        [[nodiscard]] constexpr const_iterator end() const noexcept;
+
+        [[nodiscard]] constexpr T       *data() noexcept;
+        [[nodiscard]] constexpr const T *data() const noexcept;
+
+        [[nodiscard]] constexpr size_type size() const noexcept;
+        [[nodiscard]] constexpr bool      empty() const noexcept;
+        [[nodiscard]] static constexpr size_type capacity() noexcept;
+
+        [[nodiscard]] constexpr bool operator==(const InlineVector &other) const;
+
+        // Public, so InlineVector is a structural type and can be used as a
+        // compile-time default value. Use the member functions instead.
+        std::array<T, Capacity> elements_{};
+        size_type               size_{0};
+    };
+} // namespace CLArgs
+
+template <typename T, std::size_t Capacity>
+constexpr void
+CLArgs::InlineVector<T, Capacity>::push_back(const T &value)
+{
+    if (size_ == Capacity)
+    {
+        throw std::length_error("InlineVector capacity exceeded");
+    }
+    elements_[size_++] = value;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void
+CLArgs::InlineVector<T, Capacity>::push_back(T &&value)
+{
+    if (size_ == Capacity)
+    {
+        throw std::length_error("InlineVector capacity exceeded");
+    }
+    elements_[size_++] = std::move(value);
+}
+
+template <typename T, std::size_t Capacity>
+constexpr void
+CLArgs::InlineVector<T, Capacity>::clear() noexcept
+{
+    size_ = 0;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T &
+CLArgs::InlineVector<T, Capacity>::operator[](const size_type index) noexcept
+{
+    return elements_[index];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const T &
+CLArgs::InlineVector<T, Capacity>::operator[](const size_type index) const noexcept
+{
+    return elements_[index];
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::iterator
+CLArgs::InlineVector<T, Capacity>::begin() noexcept
+{
+    return elements_.data();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::const_iterator
+CLArgs::InlineVector<T, Capacity>::begin() const noexcept
+{
+    return elements_.data();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::iterator
+CLArgs::InlineVector<T, Capacity>::end() noexcept
+{
+    return elements_.data() + size_;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::const_iterator
+CLArgs::InlineVector<T, Capacity>::end() const noexcept
+{
+    return elements_.data() + size_;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr T *
+CLArgs::InlineVector<T, Capacity>::data() noexcept
+{
+    return elements_.data();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr const T *
+CLArgs::InlineVector<T, Capacity>::data() const noexcept
+{
+    return elements_.data();
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::size_type
+CLArgs::InlineVector<T, Capacity>::size() const noexcept
+{
+    return size_;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool
+CLArgs::InlineVector<T, Capacity>::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr typename CLArgs::InlineVector<T, Capacity>::size_type
+CLArgs::InlineVector<T, Capacity>::capacity() noexcept
+{
+    return Capacity;
+}
+
+template <typename T, std::size_t Capacity>
+constexpr bool
+CLArgs::InlineVector<T, Capacity>::operator==(const InlineVector &other) const
+{
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+#endif // CLARGS_INLINE_VECTOR_HPP
@@ -0,0 +1,684 @@
+#ifndef CLARGS_NETWORK_HPP
+#define CLARGS_NETWORK_HPP
+
+#include <CLArgs/value_traits.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if __has_include(<netinet/in.h>)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#define CLARGS_HAS_SOCKADDR 1
+#endif
+
+namespace CLArgs
+{
+    // Addresses hold their bytes in network byte order, the same layout as
+    // in_addr and in6_addr, so converting to a sockaddr is a copy
+    struct Ipv4Address
+    {
+        std::array<std::uint8_t, 4> bytes{};
+
+#ifdef CLARGS_HAS_SOCKADDR
+        [[nodiscard]] in_addr to_in_addr() const noexcept;
+#endif
+
+        constexpr auto operator<=>(const Ipv4Address &) const = default;
+    };
+
+    struct Ipv6Address
+    {
+        std::array<std::uint8_t, 16> bytes{};
+
+        // Like ::ffff:192.0.2.1
+        [[nodiscard]] constexpr bool is_v4_mapped() const noexcept;
+
+#ifdef CLARGS_HAS_SOCKADDR
+        [[nodiscard]] in6_addr to_in6_addr() const noexcept;
+#endif
+
+        constexpr auto operator<=>(const Ipv6Address &) const = default;
+    };
+
+    enum class IpFamily : std::uint8_t
+    {
+        V4,
+        V6,
+    };
+
+    // An IPv4 or IPv6 address, told apart by whether the value holds a ':'
+    struct IpAddress
+    {
+        IpFamily                     family{IpFamily::V4};
+        std::array<std::uint8_t, 16> bytes{}; // An IPv4 address only uses the first four
+
+        constexpr IpAddress() noexcept = default;
+        constexpr IpAddress(const Ipv4Address &address) noexcept;
+        constexpr IpAddress(const Ipv6Address &address) noexcept;
+
+        [[nodiscard]] constexpr bool is_v4() const noexcept;
+        [[nodiscard]] constexpr bool is_v6() const noexcept;
+
+        // Only meaningful for an address of the matching family
+        [[nodiscard]] constexpr Ipv4Address v4() const noexcept;
+        [[nodiscard]] constexpr Ipv6Address v6() const noexcept;
+
+        constexpr bool operator==(const IpAddress &) const = default;
+    };
+
+    // An address and a port, parsed from "192.0.2.1:80" or "[2001:db8::1]:443".
+    // Host names are not accepted, as resolving them is up to the program.
+    struct Endpoint
+    {
+        IpAddress     address{};
+        std::uint16_t port{0};
+
+#ifdef CLARGS_HAS_SOCKADDR
+        // Fills in a sockaddr_in or sockaddr_in6 and returns its size, ready
+        // for bind() or connect()
+        socklen_t to_sockaddr(sockaddr_storage &storage) const noexcept;
+#endif
+
+        constexpr bool operator==(const Endpoint &) const = default;
+    };
+
+    template <typename T>
+    concept NetworkValue = std::is_same_v<T, Ipv4Address> || std::is_same_v<T, Ipv6Address> || std::is_same_v<T, IpAddress> ||
+                           std::is_same_v<T, Endpoint>;
+
+    // Dotted decimal only, with exactly four parts and without leading zeros,
+    // which other parsers read as octal
+    [[nodiscard]] constexpr ValueParseResult parse_ipv4_address(std::string_view sv, Ipv4Address &out) noexcept;
+
+    // The text forms of RFC 4291, including "::" and a dotted decimal tail
+    // like ::ffff:192.0.2.1. Zone indices like fe80::1%eth0 are rejected.
+    [[nodiscard]] constexpr ValueParseResult parse_ipv6_address(std::string_view sv, Ipv6Address &out) noexcept;
+
+    [[nodiscard]] constexpr ValueParseResult parse_ip_address(std::string_view sv, IpAddress &out) noexcept;
+
+    // IPv6 addresses must be in brackets, as their last group would otherwise
+    // be taken for the port
+    [[nodiscard]] constexpr ValueParseResult parse_endpoint(std::string_view sv, Endpoint &out) noexcept;
+
+    // Parses the dotted decimal address that makes up the rest of sv from
+    // offset on into octets[0..4), reporting errors against all of sv
+    [[nodiscard]] constexpr ValueParseResult parse_ipv4_octets(std::string_view sv, std::size_t offset, std::uint8_t *octets) noexcept;
+
+    // Enough for any text written by write_address(), like
+    // "[ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255]:65535"
+    inline constexpr std::size_t max_network_value_length{53};
+
+    // Write the canonical text form of RFC 5952 to out, which has room for
+    // max_network_value_length characters, and return the end of the text
+    constexpr char *write_address(const Ipv4Address &address, char *out) noexcept;
+    constexpr char *write_address(const Ipv6Address &address, char *out) noexcept;
+    constexpr char *write_address(const IpAddress &address, char *out) noexcept;
+    constexpr char *write_address(const Endpoint &endpoint, char *out) noexcept;
+
+    template <>
+    struct ValueTraits<Ipv4Address>
+    {
+        static constexpr std::string_view name{"IPv4 address"};
+
+        static ValueParseResult parse(std::string_view sv, Ipv4Address &out) noexcept;
+    };
+
+    template <>
+    struct ValueTraits<Ipv6Address>
+    {
+        static constexpr std::string_view name{"IPv6 address"};
+
+        static ValueParseResult parse(std::string_view sv, Ipv6Address &out) noexcept;
+    };
+
+    template <>
+    struct ValueTraits<IpAddress>
+    {
+        static constexpr std::string_view name{"IP address"};
+
+        static ValueParseResult parse(std::string_view sv, IpAddress &out) noexcept;
+    };
+
+    template <>
+    struct ValueTraits<Endpoint>
+    {
+        static constexpr std::string_view name{"endpoint"};
+
+        static ValueParseResult parse(std::string_view sv, Endpoint &out) noexcept;
+    };
+} // namespace CLArgs
+
+#ifdef CLARGS_HAS_SOCKADDR
+inline in_addr
+CLArgs::Ipv4Address::to_in_addr() const noexcept
+{
+    in_addr result{};
+    std::memcpy(&result, bytes.data(), bytes.size());
+    return result;
+}
+#endif
+
+constexpr bool
+CLArgs::Ipv6Address::is_v4_mapped() const noexcept
+{
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        if (bytes[i] != 0)
+        {
+            return false;
+        }
+    }
+    return bytes[10] == 0xFF && bytes[11] == 0xFF;
+}
+
+#ifdef CLARGS_HAS_SOCKADDR
+inline in6_addr
+CLArgs::Ipv6Address::to_in6_addr() const noexcept
+{
+    in6_addr result{};
+    std::memcpy(&result, bytes.data(), bytes.size());
+    return result;
+}
+#endif
+
+constexpr CLArgs::IpAddress::IpAddress(const Ipv4Address &address) noexcept
+    : family{IpFamily::V4}
+{
+    for (std::size_t i = 0; i < address.bytes.size(); ++i)
+    {
+        bytes[i] = address.bytes[i];
+    }
+}
+
+constexpr CLArgs::IpAddress::IpAddress(const Ipv6Address &address) noexcept
+    : family{IpFamily::V6}
+    , bytes{address.bytes}
+{
+}
+
+constexpr bool
+CLArgs::IpAddress::is_v4() const noexcept
+{
+    return family == IpFamily::V4;
+}
+
+constexpr bool
+CLArgs::IpAddress::is_v6() const noexcept
+{
+    return family == IpFamily::V6;
+}
+
+constexpr CLArgs::Ipv4Address
+CLArgs::IpAddress::v4() const noexcept
+{
+    return Ipv4Address{{bytes[0], bytes[1], bytes[2], bytes[3]}};
+}
+
+constexpr CLArgs::Ipv6Address
+CLArgs::IpAddress::v6() const noexcept
+{
+    return Ipv6Address{bytes};
+}
+
+#ifdef CLARGS_HAS_SOCKADDR
+inline socklen_t
+CLArgs::Endpoint::to_sockaddr(sockaddr_storage &storage) const noexcept
+{
+    storage = {};
+
+    if (address.is_v4())
+    {
+        sockaddr_in ipv4{};
+        ipv4.sin_family = AF_INET;
+        ipv4.sin_port   = htons(port);
+        ipv4.sin_addr   = address.v4().to_in_addr();
+        std::memcpy(&storage, &ipv4, sizeof(ipv4));
+        return static_cast<socklen_t>(sizeof(ipv4));
+    }
+
+    sockaddr_in6 ipv6{};
+    ipv6.sin6_family = AF_INET6;
+    ipv6.sin6_port   = htons(port);
+    ipv6.sin6_addr   = address.v6().to_in6_addr();
+    std::memcpy(&storage, &ipv6, sizeof(ipv6));
+    return static_cast<socklen_t>(sizeof(ipv6));
+}
+#endif
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_ipv4_octets(const std::string_view sv, std::size_t offset, std::uint8_t *octets) noexcept
+{
+    for (std::size_t part = 0; part < 4; ++part)
+    {
+        if (part > 0)
+        {
+            if (offset == sv.size() || sv[offset] != '.')
+            {
+                return {ParseStatus::InvalidFormat, offset, "Expected '.'"};
+            }
+            ++offset;
+        }
+
+        // At most one digit more than needed, so the value cannot overflow
+        const std::size_t start = offset;
+        unsigned int      value = 0;
+        while (offset < sv.size() && offset - start < 4 && sv[offset] >= '0' && sv[offset] <= '9')
+        {
+            value = value * 10 + static_cast<unsigned int>(sv[offset] - '0');
+            ++offset;
+        }
+
+        if (offset == start)
+        {
+            return {ParseStatus::InvalidFormat, offset, "Expected a decimal number"};
+        }
+        if (offset - start > 1 && sv[start] == '0')
+        {
+            return {ParseStatus::InvalidFormat, start, "Leading zeros are not allowed"};
+        }
+        if (value > 255)
+        {
+            return {ParseStatus::OutOfRange, start, "Number must be at most 255"};
+        }
+
+        octets[part] = static_cast<std::uint8_t>(value);
+    }
+
+    if (offset != sv.size())
+    {
+        return {ParseStatus::InvalidFormat, offset, "Unexpected character"};
+    }
+
+    return {};
+}
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_ipv4_address(const std::string_view sv, Ipv4Address &out) noexcept
+{
+    return parse_ipv4_octets(sv, 0, out.bytes.data());
+}
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_ipv6_address(const std::string_view sv, Ipv6Address &out) noexcept
+{
+    constexpr std::size_t no_compression = 8;
+
+    const auto hex_digit_value = [](const char c) -> int
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f')
+        {
+            return c - 'a' + 10;
+        }
+        if (c >= 'A' && c <= 'F')
+        {
+            return c - 'A' + 10;
+        }
+        return -1;
+    };
+
+    std::array<std::uint16_t, 8> groups{};
+    std::size_t                  group_count    = 0;
+    std::size_t                  compression_at = no_compression;
+    std::size_t                  offset         = 0;
+
+    if (sv.starts_with("::"))
+    {
+        compression_at = 0;
+        offset         = 2;
+    }
+    else if (sv.starts_with(':'))
+    {
+        return {ParseStatus::InvalidFormat, 0, "Expected a hexadecimal group"};
+    }
+
+    while (offset < sv.size())
+    {
+        if (group_count == groups.size())
+        {
+            return {ParseStatus::InvalidFormat, offset, "Too many groups"};
+        }
+
+        const std::size_t start = offset;
+        std::uint16_t     value = 0;
+        while (offset < sv.size() && offset - start < 4 && hex_digit_value(sv[offset]) >= 0)
+        {
+            value = static_cast<std::uint16_t>(value * 16 + hex_digit_value(sv[offset]));
+            ++offset;
+        }
+
+        // A dotted decimal tail stands for the last two groups
+        if (offset < sv.size() && sv[offset] == '.')
+        {
+            if (group_count > groups.size() - 2)
+            {
+                return {ParseStatus::InvalidFormat, start, "Too many groups"};
+            }
+
+            std::array<std::uint8_t, 4> octets{};
+            if (const ValueParseResult result = parse_ipv4_octets(sv, start, octets.data()); !result)
+            {
+                return result;
+            }
+            groups[group_count++] = static_cast<std::uint16_t>(octets[0] << 8 | octets[1]);
+            groups[group_count++] = static_cast<std::uint16_t>(octets[2] << 8 | octets[3]);
+            break;
+        }
+
+        if (offset == start)
+        {
+            return {ParseStatus::InvalidFormat, offset, "Expected a hexadecimal group"};
+        }
+        if (offset < sv.size() && hex_digit_value(sv[offset]) >= 0)
+        {
+            return {ParseStatus::InvalidFormat, start, "Group has more than four digits"};
+        }
+
+        groups[group_count++] = value;
+
+        if (offset == sv.size())
+        {
+            break;
+        }
+        if (sv[offset] != ':')
+        {
+            return {ParseStatus::InvalidFormat, offset, "Unexpected character"};
+        }
+        ++offset;
+
+        if (offset < sv.size() && sv[offset] == ':')
+        {
+            if (compression_at != no_compression)
+            {
+                return {ParseStatus::InvalidFormat, offset - 1, "Only one \"::\" is allowed"};
+            }
+            compression_at = group_count;
+            ++offset;
+        }
+        else if (offset == sv.size())
+        {
+            return {ParseStatus::InvalidFormat, offset, "Expected a hexadecimal group"};
+        }
+    }
+
+    if (compression_at == no_compression && group_count != groups.size())
+    {
+        return {ParseStatus::InvalidFormat, sv.size(), "Expected 8 groups"};
+    }
+    if (compression_at != no_compression && group_count == groups.size())
+    {
+        return {ParseStatus::InvalidFormat, sv.size(), "\"::\" must stand for at least one group"};
+    }
+
+    // Groups after the "::" move to the end, the ones it stands for are zero
+    if (compression_at != no_compression)
+    {
+        const std::size_t skipped = groups.size() - group_count;
+        for (std::size_t i = group_count; i > compression_at; --i)
+        {
+            groups[i - 1 + skipped] = groups[i - 1];
+            groups[i - 1]           = 0;
+        }
+    }
+
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        out.bytes[2 * i]     = static_cast<std::uint8_t>(groups[i] >> 8);
+        out.bytes[2 * i + 1] = static_cast<std::uint8_t>(groups[i] & 0xFF);
+    }
+
+    return {};
+}
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_ip_address(const std::string_view sv, IpAddress &out) noexcept
+{
+    if (sv.find(':') != std::string_view::npos)
+    {
+        Ipv6Address address;
+        const auto  result = parse_ipv6_address(sv, address);
+        out                = address;
+        return result;
+    }
+
+    Ipv4Address address;
+    const auto  result = parse_ipv4_address(sv, address);
+    out                = address;
+    return result;
+}
+
+constexpr CLArgs::ValueParseResult
+CLArgs::parse_endpoint(const std::string_view sv, Endpoint &out) noexcept
+{
+    std::size_t port_separator{};
+
+    if (sv.starts_with('['))
+    {
+        port_separator = sv.find(']');
+        if (port_separator == std::string_view::npos)
+        {
+            return {ParseStatus::InvalidFormat, sv.size(), "Expected ']'"};
+        }
+
+        Ipv6Address      address;
+        ValueParseResult result = parse_ipv6_address(sv.substr(1, port_separator - 1), address);
+        if (!result)
+        {
+            result.error_offset += 1;
+            return result;
+        }
+        out.address = address;
+        ++port_separator;
+    }
+    else
+    {
+        port_separator = sv.find(':');
+        if (port_separator == std::string_view::npos)
+        {
+            return {ParseStatus::InvalidFormat, sv.size(), "Expected ':' and port"};
+        }
+        if (sv.find(':', port_separator + 1) != std::string_view::npos)
+        {
+            return {ParseStatus::InvalidFormat, 0, "IPv6 addresses must be in brackets, like [::1]:80"};
+        }
+
+        Ipv4Address address;
+        if (const ValueParseResult result = parse_ipv4_address(sv.substr(0, port_separator), address); !result)
+        {
+            return result;
+        }
+        out.address = address;
+    }
+
+    if (port_separator == sv.size() || sv[port_separator] != ':')
+    {
+        return {ParseStatus::InvalidFormat, port_separator, "Expected ':' and port"};
+    }
+
+    const std::size_t start  = port_separator + 1;
+    std::size_t       offset = start;
+    std::uint32_t     port   = 0;
+    while (offset < sv.size() && sv[offset] >= '0' && sv[offset] <= '9')
+    {
+        port = port * 10 + static_cast<std::uint32_t>(sv[offset] - '0');
+        if (port > 65535)
+        {
+            return {ParseStatus::OutOfRange, start, "Port must be at most 65535"};
+        }
+        ++offset;
+    }
+
+    if (offset == start)
+    {
+        return {ParseStatus::InvalidFormat, offset, "Expected a port number"};
+    }
+    if (offset != sv.size())
+    {
+        return {ParseStatus::InvalidFormat, offset, "Unexpected character"};
+    }
+
+    out.port = static_cast<std::uint16_t>(port);
+    return {};
+}
+
+constexpr char *
+CLArgs::write_address(const Ipv4Address &address, char *out) noexcept
+{
+    for (std::size_t part = 0; part < address.bytes.size(); ++part)
+    {
+        if (part > 0)
+        {
+            *out++ = '.';
+        }
+
+        const unsigned int value = address.bytes[part];
+        if (value >= 100)
+        {
+            *out++ = static_cast<char>('0' + value / 100);
+        }
+        if (value >= 10)
+        {
+            *out++ = static_cast<char>('0' + value / 10 % 10);
+        }
+        *out++ = static_cast<char>('0' + value % 10);
+    }
+    return out;
+}
+
+constexpr char *
+CLArgs::write_address(const Ipv6Address &address, char *out) noexcept
+{
+    constexpr std::string_view hex_digits{"0123456789abcdef"};
+
+    if (address.is_v4_mapped())
+    {
+        for (const char c : std::string_view{"::ffff:"})
+        {
+            *out++ = c;
+        }
+        return write_address(Ipv4Address{{address.bytes[12], address.bytes[13], address.bytes[14], address.bytes[15]}}, out);
+    }
+
+    std::array<std::uint16_t, 8> groups{};
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        groups[i] = static_cast<std::uint16_t>(address.bytes[2 * i] << 8 | address.bytes[2 * i + 1]);
+    }
+
+    // The first of the longest runs of at least two zero groups becomes "::"
+    std::size_t run_start  = groups.size();
+    std::size_t run_length = 1;
+    for (std::size_t i = 0; i < groups.size();)
+    {
+        std::size_t length = 0;
+        while (i + length < groups.size() && groups[i + length] == 0)
+        {
+            ++length;
+        }
+        if (length > run_length)
+        {
+            run_start  = i;
+            run_length = length;
+        }
+        i += length > 0 ? length : 1;
+    }
+
+    for (std::size_t i = 0; i < groups.size(); ++i)
+    {
+        if (i == run_start)
+        {
+            *out++ = ':';
+            *out++ = ':';
+            i += run_length - 1;
+            continue;
+        }
+        if (i > 0 && i != run_start + run_length)
+        {
+            *out++ = ':';
+        }
+
+        bool leading = true;
+        for (int shift = 12; shift >= 0; shift -= 4)
+        {
+            const std::size_t digit = (groups[i] >> shift) & 0xF;
+            if (digit != 0 || !leading || shift == 0)
+            {
+                *out++  = hex_digits[digit];
+                leading = false;
+            }
+        }
+    }
+    return out;
+}
+
+constexpr char *
+CLArgs::write_address(const IpAddress &address, char *out) noexcept
+{
+    return address.is_v4() ? write_address(address.v4(), out) : write_address(address.v6(), out);
+}
+
+constexpr char *
+CLArgs::write_address(const Endpoint &endpoint, char *out) noexcept
+{
+    if (endpoint.address.is_v6())
+    {
+        *out++ = '[';
+        out    = write_address(endpoint.address, out);
+        *out++ = ']';
+    }
+    else
+    {
+        out = write_address(endpoint.address, out);
+    }
+    *out++ = ':';
+
+    std::array<char, 5> digits{};
+    std::size_t         count = 0;
+    unsigned int        port  = endpoint.port;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + port % 10);
+        port /= 10;
+    } while (port != 0);
+
+    while (count > 0)
+    {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::Ipv4Address>::parse(const std::string_view sv, Ipv4Address &out) noexcept
+{
+    return parse_ipv4_address(sv, out);
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::Ipv6Address>::parse(const std::string_view sv, Ipv6Address &out) noexcept
+{
+    return parse_ipv6_address(sv, out);
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::IpAddress>::parse(const std::string_view sv, IpAddress &out) noexcept
+{
+    return parse_ip_address(sv, out);
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::Endpoint>::parse(const std::string_view sv, Endpoint &out) noexcept
+{
+    return parse_endpoint(sv, out);
+}
+
+#endif // CLARGS_NETWORK_HPP
@@ -0,0 +1,368 @@
+#ifndef CLARGS_OPTION_GROUP_HPP
+#define CLARGS_OPTION_GROUP_HPP
+
+#include <CLArgs/core.hpp>
+#include <CLArgs/identifier_trie.hpp>
+#include <CLArgs/value_container.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace CLArgs
+{
+    // The long identifiers of Member in the namespace Prefix, so "--size"
+    // becomes "--db.pool.size" for the prefix "db.pool". Short identifiers
+    // cannot be namespaced and are left out.
+    template <StringLiteral Prefix, Parsable Member>
+    [[nodiscard]] consteval auto namespaced_identifier_characters();
+
+    template <StringLiteral Prefix, Parsable Member, std::size_t N>
+    [[nodiscard]] consteval auto namespaced_identifier_views(const std::array<char, N> &characters);
+
+    template <StringLiteral Prefix, Parsable Member>
+    struct NamespacedIdentifiers
+    {
+        static constexpr auto characters{namespaced_identifier_characters<Prefix, Member>()};
+        static constexpr auto identifiers{namespaced_identifier_views<Prefix, Member>(characters)};
+    };
+
+    template <CmdOption Option>
+    [[nodiscard]] consteval auto default_value_of();
+
+    // Member of an option group, with the identifiers of the group. Values
+    // are stored for the namespaced type, so the same Member can be part of
+    // several groups.
+    template <StringLiteral Prefix, Parsable Member>
+    struct Namespaced;
+
+    template <StringLiteral Prefix, CmdFlag Member>
+        requires(!CmdOption<Member>)
+    struct Namespaced<Prefix, Member>
+    {
+        static constexpr auto             identifiers{NamespacedIdentifiers<Prefix, Member>::identifiers};
+        static constexpr std::string_view description{Member::description};
+        static constexpr bool             terminating{TerminatingFlag<Member>};
+
+        using ValueType = bool;
+    };
+
+    template <StringLiteral Prefix, CmdOption Member>
+    struct Namespaced<Prefix, Member>
+    {
+        static constexpr auto             identifiers{NamespacedIdentifiers<Prefix, Member>::identifiers};
+        static constexpr std::string_view value_hint{Member::value_hint};
+        static constexpr std::string_view description{Member::description};
+        static constexpr auto             default_value{default_value_of<Member>()};
+
+        using ValueType = typename Member::ValueType;
+    };
+
+    template <StringLiteral Prefix, typename... Members>
+    struct OptionGroup;
+
+    template <typename T>
+    struct is_option_group : std::false_type
+    {
+    };
+
+    template <StringLiteral Prefix, typename... Members>
+    struct is_option_group<OptionGroup<Prefix, Members...>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    concept CmdOptionGroup = is_option_group<T>::value;
+
+    // The Parsables a member of the group with Prefix adds to the parser, as
+    // a std::tuple. Nested groups add all of their members.
+    template <StringLiteral Prefix, typename Member>
+    struct GroupMemberParsables;
+
+    template <StringLiteral Prefix, Parsable Member>
+    struct GroupMemberParsables<Prefix, Member>
+    {
+        using Type = std::tuple<Namespaced<Prefix, Member>>;
+    };
+
+    template <StringLiteral Prefix, typename Tuple>
+    struct NamespacedTuple;
+
+    template <StringLiteral Prefix, Parsable... Parsables>
+    struct NamespacedTuple<Prefix, std::tuple<Parsables...>>
+    {
+        using Type = std::tuple<Namespaced<Prefix, Parsables>...>;
+    };
+
+    template <StringLiteral Prefix, CmdOptionGroup Member>
+    struct GroupMemberParsables<Prefix, Member>
+    {
+        using Type = typename NamespacedTuple<Prefix, typename Member::ParsableList>::Type;
+    };
+
+    // The flags and options of a tuple of Parsables, split as a parser takes them
+    template <typename Tuple>
+    struct SplitParsables;
+
+    template <bool Condition, typename T>
+    using tuple_if_t = std::conditional_t<Condition, std::tuple<T>, std::tuple<>>;
+
+    template <Parsable... Parsables>
+    struct SplitParsables<std::tuple<Parsables...>>
+    {
+        using FlagList   = decltype(std::tuple_cat(std::declval<tuple_if_t<!CmdOption<Parsables>, Parsables>>()...));
+        using OptionList = decltype(std::tuple_cat(std::declval<tuple_if_t<CmdOption<Parsables>, Parsables>>()...));
+    };
+
+    // Options sharing the namespace Prefix, e.g. OptionGroup<"db.pool", Size,
+    // Timeout> for --db.pool.size and --db.pool.timeout. Members are flags,
+    // options or nested groups, whose prefix is appended to the one of the
+    // enclosing group. Groups are added to a parser with
+    // ParserBuilder::add_group(), and their values are read through an
+    // OptionGroupView, using the member types as declared in the group.
+    template <StringLiteral Prefix, typename... Members>
+    struct OptionGroup
+    {
+        static_assert(sizeof...(Members) >= 1, "Option group must have at least one member");
+        static_assert(((Parsable<Members> || CmdOptionGroup<Members>) && ...), "Option group members must be flags, options or groups");
+        static_assert(all_unique_v<Members...>, "Duplicate option group members are not allowed");
+
+        static constexpr std::string_view prefix{Prefix.value};
+
+        // Every flag and option of the group with its namespaced identifiers,
+        // in declaration order, with nested groups flattened
+        using ParsableList = decltype(std::tuple_cat(std::declval<typename GroupMemberParsables<Prefix, Members>::Type>()...));
+        using FlagList     = typename SplitParsables<ParsableList>::FlagList;
+        using OptionList   = typename SplitParsables<ParsableList>::OptionList;
+
+        template <typename Member>
+        static constexpr bool has_member{is_part_of_v<Member, Members...>};
+
+        // Index into ParsableList of Member, or of the first Parsable of Member
+        // if it is a nested group
+        template <typename Member>
+        [[nodiscard]] static consteval std::size_t offset_of();
+    };
+
+    template <typename Tuple, Parsable... Ts>
+    struct TupleElementsPartOf;
+
+    template <typename... Elements, Parsable... Ts>
+    struct TupleElementsPartOf<std::tuple<Elements...>, Ts...> : std::bool_constant<(is_part_of_v<Elements, Ts...> && ...)>
+    {
+    };
+
+    // Whether all flags and options of Group are part of Ts
+    template <CmdOptionGroup Group, Parsable... Ts>
+    inline constexpr bool group_part_of_v = TupleElementsPartOf<typename Group::ParsableList, Ts...>::value;
+
+    // The values of one option group, to hand to the code that owns them
+    // without exposing the parser. A view only holds a pointer per member,
+    // and must not outlive the parser it was created from.
+    template <CmdOptionGroup Group>
+    class OptionGroupView
+    {
+    public:
+        template <Parsable... Stored>
+        explicit OptionGroupView(const ValueContainer<Stored...> &values) noexcept;
+
+        template <CmdFlag Flag>
+        [[nodiscard]] bool has_flag() const noexcept
+            requires Group::template has_member<Flag>;
+
+        template <CmdOption Option>
+        [[nodiscard]] const std::optional<typename Option::ValueType> &get_option() const noexcept
+            requires Group::template has_member<Option>;
+
+        template <CmdOptionWithDefault Option>
+        [[nodiscard]] const typename Option::ValueType &get() const noexcept
+            requires Group::template has_member<Option>;
+
+        template <CmdOptionGroup Inner>
+        [[nodiscard]] OptionGroupView<Inner> group() const noexcept
+            requires Group::template has_member<Inner>;
+
+    private:
+        template <CmdOptionGroup>
+        friend class OptionGroupView;
+
+        static constexpr std::size_t size_{std::tuple_size_v<typename Group::ParsableList>};
+
+        explicit OptionGroupView(const void *const *values) noexcept;
+
+        template <Parsable Member>
+        [[nodiscard]] const std::optional<typename Member::ValueType> &value() const noexcept;
+
+        // Points to the std::optional holding the value of every element of
+        // Group::ParsableList, in the ValueContainer of the parser
+        std::array<const void *, size_> values_{};
+    };
+} // namespace CLArgs
+
+template <CLArgs::StringLiteral Prefix, CLArgs::Parsable Member>
+consteval auto
+CLArgs::namespaced_identifier_characters()
+{
+    constexpr std::string_view prefix{Prefix.value};
+
+    static_assert(!prefix.empty(), "Option group prefix cannot be empty");
+    static_assert(!prefix.starts_with('-'), "Option group prefix must not start with '-'");
+    static_assert(!prefix.starts_with('.') && !prefix.ends_with('.'), "Option group prefix must not start or end with '.'");
+    static_assert(std::ranges::any_of(Member::identifiers, is_long_identifier), "Option group members need a long identifier");
+
+    // "--" + prefix + "." + the identifier without its "--"
+    constexpr std::size_t length = []
+    {
+        std::size_t characters = 0;
+        for (const std::string_view identifier : Member::identifiers)
+        {
+            characters += is_long_identifier(identifier) ? identifier.size() + std::string_view{Prefix.value}.size() + 1 : 0;
+        }
+        return characters;
+    }();
+
+    std::array<char, length> result{};
+    auto                     out = result.begin();
+    for (const std::string_view identifier : Member::identifiers)
+    {
+        if (is_long_identifier(identifier))
+        {
+            out    = std::ranges::copy(std::string_view{"--"}, out).out;
+            out    = std::ranges::copy(prefix, out).out;
+            *out++ = '.';
+            out    = std::ranges::copy(identifier.substr(2), out).out;
+        }
+    }
+    return result;
+}
+
+template <CLArgs::StringLiteral Prefix, CLArgs::Parsable Member, std::size_t N>
+consteval auto
+CLArgs::namespaced_identifier_views(const std::array<char, N> &characters)
+{
+    constexpr std::size_t prefix_length = std::string_view{Prefix.value}.size();
+    constexpr std::size_t count         = std::ranges::count_if(Member::identifiers, is_long_identifier);
+
+    std::array<std::string_view, count> result{};
+    std::size_t                         offset = 0;
+    std::size_t                         index  = 0;
+    for (const std::string_view identifier : Member::identifiers)
+    {
+        if (is_long_identifier(identifier))
+        {
+            const std::size_t length = identifier.size() + prefix_length + 1;
+            result[index++]          = std::string_view{characters.data() + offset, length};
+            offset += length;
+        }
+    }
+    return result;
+}
+
+template <CLArgs::CmdOption Option>
+consteval auto
+CLArgs::default_value_of()
+{
+    if constexpr (CmdOptionWithDefault<Option>)
+    {
+        return Option::default_value;
+    }
+    else
+    {
+        return NoDefaultValue{};
+    }
+}
+
+template <CLArgs::StringLiteral Prefix, typename... Members>
+template <typename Member>
+consteval std::size_t
+CLArgs::OptionGroup<Prefix, Members...>::offset_of()
+{
+    static_assert(has_member<Member>, "Not a member of the option group");
+
+    std::size_t offset = 0;
+    bool        found  = false;
+    (
+        [&offset, &found]
+        {
+            found = found || std::is_same_v<Member, Members>;
+            if (!found)
+            {
+                offset += std::tuple_size_v<typename GroupMemberParsables<Prefix, Members>::Type>;
+            }
+        }(),
+        ...);
+    return offset;
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::Parsable... Stored>
+CLArgs::OptionGroupView<Group>::OptionGroupView(const ValueContainer<Stored...> &values) noexcept
+{
+    static_assert(group_part_of_v<Group, Stored...>, "Option group is not part of the parser");
+
+    [this, &values]<std::size_t... Indices>(std::index_sequence<Indices...>)
+    {
+        values_ = {&values.template get_value<std::tuple_element_t<Indices, typename Group::ParsableList>>()...};
+    }(std::make_index_sequence<size_>{});
+}
+
+template <CLArgs::CmdOptionGroup Group>
+CLArgs::OptionGroupView<Group>::OptionGroupView(const void *const *values) noexcept
+{
+    std::copy_n(values, size_, values_.begin());
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::CmdFlag Flag>
+bool
+CLArgs::OptionGroupView<Group>::has_flag() const noexcept
+    requires Group::template has_member<Flag>
+{
+    const auto &opt = value<Flag>();
+    return opt.has_value() && (opt.value() == true);
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::CmdOption Option>
+const std::optional<typename Option::ValueType> &
+CLArgs::OptionGroupView<Group>::get_option() const noexcept
+    requires Group::template has_member<Option>
+{
+    return value<Option>();
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::CmdOptionWithDefault Option>
+const typename Option::ValueType &
+CLArgs::OptionGroupView<Group>::get() const noexcept
+    requires Group::template has_member<Option>
+{
+    return *value<Option>();
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::CmdOptionGroup Inner>
+CLArgs::OptionGroupView<Inner>
+CLArgs::OptionGroupView<Group>::group() const noexcept
+    requires Group::template has_member<Inner>
+{
+    // Members of a nested group are stored next to each other, in the same
+    // order as in the nested group itself
+    return OptionGroupView<Inner>{values_.data() + Group::template offset_of<Inner>()};
+}
+
+template <CLArgs::CmdOptionGroup Group>
+template <CLArgs::Parsable Member>
+const std::optional<typename Member::ValueType> &
+CLArgs::OptionGroupView<Group>::value() const noexcept
+{
+    using Stored = std::optional<typename Member::ValueType>;
+    return *static_cast<const Stored *>(values_[Group::template offset_of<Member>()]);
+}
+
+#endif // CLARGS_OPTION_GROUP_HPP
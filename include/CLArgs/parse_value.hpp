@@ -2,6 +2,9 @@
 #define CLARGS_PARSE_VALUE_HPP
 
 #include <CLArgs/core.hpp>
+#include <CLArgs/inline_vector.hpp>
+#include <CLArgs/quantity.hpp>
+#include <CLArgs/value_traits.hpp>
 
 #include <algorithm>
 #include <array>
@@ -9,16 +12,28 @@
 #include <chrono>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
 #include <exception>
 #include <filesystem>
+#include <limits>
+#include <memory_resource>
+#include <span>
 #include <sstream>
+#include <string>
 #include <string_view>
+#include <tuple>
 
 namespace CLArgs
 {
     template <typename T>
     T parse_value(std::string_view);
 
+    // Overload used by the parser, so allocator-aware value types can be
+    // constructed directly in the parser's memory resource
+    template <typename T>
+    T parse_value(std::string_view, std::pmr::memory_resource *);
+
     template <std::integral T>
     T parse_value(std::string_view)
         requires(!std::is_same_v<T, bool> && !std::is_same_v<T, char>);
@@ -32,9 +47,64 @@ namespace CLArgs
         typename T::period;
     } && std::is_same_v<T, std::chrono::duration<typename T::rep, typename T::period>>;
 
+    // Durations take a bare number in their own unit, or one or more numbers
+    // with a unit from duration_suffixes, like "250ms" or "1h30m". With an
+    // integral rep, the result must be a whole number of the duration's unit.
     template <StdChronoDuration T>
     T parse_value(std::string_view);
 
+    // Parses a sequence of numbers with a suffix from units into a count of
+    // target, T only names the type in error messages. A bare number counts
+    // target itself and cannot be followed by another number.
+    template <typename T, typename Count>
+    Count parse_quantity(std::string_view sv, std::string_view quantity, std::span<const UnitSuffix> units, const UnitSuffix &target);
+
+    template <typename T>
+    std::uint64_t scale_quantity(std::string_view sv, std::uint64_t count, const UnitSuffix &unit, const UnitSuffix &target);
+
+    template <TraitsParsableValue T>
+    T parse_value(std::string_view);
+
+    // Parses without throwing. Types with ValueTraits are parsed in place,
+    // for other types the exception of parse_value<T>() is caught, so its
+    // message and offset are lost.
+    template <typename T>
+    ValueParseResult try_parse_value(std::string_view sv, T &out) noexcept;
+
+    template <typename T>
+    concept StdArray = requires {
+        typename T::value_type;
+        std::tuple_size<T>::value;
+    } && std::is_same_v<T, std::array<typename T::value_type, std::tuple_size_v<T>>>;
+
+    template <typename T>
+    concept InlineVectorType = requires {
+        typename T::value_type;
+        T::capacity();
+    } && std::is_same_v<T, InlineVector<typename T::value_type, T::capacity()>>;
+
+    inline constexpr char list_delimiter{','};
+
+    // Lists like "80,443,8080" are split on list_delimiter, and every element
+    // is parsed with the parse_value() overload of the element type. A
+    // std::array takes exactly as many elements as it holds, an InlineVector
+    // at most as many as its capacity.
+    template <StdArray T>
+    T parse_value(std::string_view);
+
+    template <InlineVectorType T>
+    T parse_value(std::string_view);
+
+    // Calls callback(index, element) for every element of a delimited list
+    // and returns the number of elements
+    template <typename Callback>
+    std::size_t for_each_list_element(std::string_view sv, Callback &&callback);
+
+    // Parses one element of the list sv, reporting errors against the whole
+    // list with the index of the element
+    template <typename ListType, typename ElementType>
+    ElementType parse_list_element(std::string_view sv, std::size_t index, std::string_view element);
+
     template <typename T>
     constexpr std::string_view pretty_string_of_type();
 
@@ -48,6 +118,15 @@ namespace CLArgs
     template <StdChronoDuration T>
     constexpr std::string_view pretty_string_of_type();
 
+    template <NamedValueTraits T>
+    constexpr std::string_view pretty_string_of_type();
+
+    template <StdArray T>
+    constexpr std::string_view pretty_string_of_type();
+
+    template <InlineVectorType T>
+    constexpr std::string_view pretty_string_of_type();
+
     template <typename T>
     class ParseValueException final : public std::invalid_argument
     {
@@ -65,8 +144,12 @@ template <typename T>
 CLArgs::ParseValueException<T>::ParseValueException(const std::string_view user_string, const std::string_view error_msg)
     : std::invalid_argument("")
 {
-    what_ = std::string("Unable to parse \"") + user_string.data() + "\" as type \"" + pretty_string_of_type<T>().data() +
-            "\": " + error_msg.data();
+    what_ = std::string("Unable to parse \"");
+    what_ += user_string;
+    what_ += "\" as type \"";
+    what_ += pretty_string_of_type<T>();
+    what_ += "\": ";
+    what_ += error_msg;
 }
 
 template <typename T>
@@ -252,6 +335,25 @@ CLArgs::parse_value<std::string>(const std::string_view sv)
     return std::string(sv);
 }
 
+template <>
+inline std::pmr::string
+CLArgs::parse_value<std::pmr::string>(const std::string_view sv, std::pmr::memory_resource *resource)
+{
+    if (sv.empty())
+    {
+        throw ParseValueException<std::pmr::string>(sv, "String cannot be empty");
+    }
+
+    return std::pmr::string(sv, resource);
+}
+
+template <>
+inline std::pmr::string
+CLArgs::parse_value<std::pmr::string>(const std::string_view sv)
+{
+    return parse_value<std::pmr::string>(sv, std::pmr::get_default_resource());
+}
+
 template <>
 inline std::string_view
 CLArgs::parse_value<std::string_view>(const std::string_view sv)
@@ -261,7 +363,7 @@ CLArgs::parse_value<std::string_view>(const std::string_view sv)
         throw ParseValueException<std::string_view>(sv, "String cannot be empty");
     }
 
-    return sv.data();
+    return sv;
 }
 
 template <>
@@ -276,6 +378,112 @@ CLArgs::parse_value<std::filesystem::path>(const std::string_view sv)
     return {sv};
 }
 
+template <typename T>
+std::uint64_t
+CLArgs::scale_quantity(const std::string_view sv, const std::uint64_t count, const UnitSuffix &unit, const UnitSuffix &target)
+{
+    UnitSuffix factor;
+    if (!unit_conversion_factor(unit, target, factor))
+    {
+        throw ParseValueException<T>(sv, "Number out of range");
+    }
+
+    if (count % factor.denominator != 0)
+    {
+        std::string error_msg = "Not a whole number of ";
+        error_msg += pretty_string_of_type<T>();
+        throw ParseValueException<T>(sv, error_msg);
+    }
+
+    std::uint64_t scaled{};
+    if (!checked_multiply(count / factor.denominator, factor.numerator, scaled))
+    {
+        throw ParseValueException<T>(sv, "Number out of range");
+    }
+    return scaled;
+}
+
+template <typename T, typename Count>
+Count
+CLArgs::parse_quantity(const std::string_view           sv,
+                       const std::string_view           quantity,
+                       const std::span<const UnitSuffix> units,
+                       const UnitSuffix                &target)
+{
+    if (quantity.empty())
+    {
+        throw ParseValueException<T>(sv, "Invalid format");
+    }
+
+    const char *first = quantity.data();
+    const char *last  = quantity.data() + quantity.size();
+
+    Count total{};
+    bool  is_first_number = true;
+
+    while (first != last)
+    {
+        // The caller has taken off the leading sign. from_chars() accepts a
+        // '-' for floating-point counts, which would make "1h-30m" subtract.
+        if (*first == '-' || *first == '+')
+        {
+            const std::string error_msg = std::string("Invalid character at '") + *first + '\'';
+            throw ParseValueException<T>(sv, error_msg);
+        }
+
+        Count count{};
+        const auto [number_end, ec] = std::from_chars(first, last, count);
+
+        if (ec == std::errc::invalid_argument)
+        {
+            throw ParseValueException<T>(sv, "Invalid format");
+        }
+
+        if (ec == std::errc::result_out_of_range)
+        {
+            throw ParseValueException<T>(sv, "Number out of range");
+        }
+
+        const char *suffix_end = std::find_if(number_end, last, [](const char c) { return !is_unit_character(c); });
+        const std::string_view suffix(number_end, static_cast<std::size_t>(suffix_end - number_end));
+
+        if (suffix.empty() && number_end != last)
+        {
+            const std::string error_msg = std::string("Invalid character at '") + *number_end + '\'';
+            throw ParseValueException<T>(sv, error_msg);
+        }
+
+        if (suffix.empty() && !is_first_number)
+        {
+            throw ParseValueException<T>(sv, "Missing unit after the last number");
+        }
+
+        const UnitSuffix *unit = suffix.empty() ? &target : find_unit_suffix(units, suffix);
+        if (unit == nullptr)
+        {
+            std::string error_msg = "Unknown unit \"";
+            error_msg += suffix;
+            error_msg += '"';
+            throw ParseValueException<T>(sv, error_msg);
+        }
+
+        if constexpr (std::is_floating_point_v<Count>)
+        {
+            total += count * static_cast<Count>(unit->numerator) / static_cast<Count>(unit->denominator) *
+                     static_cast<Count>(target.denominator) / static_cast<Count>(target.numerator);
+        }
+        else if (!checked_add(total, scale_quantity<T>(sv, count, *unit, target), total))
+        {
+            throw ParseValueException<T>(sv, "Number out of range");
+        }
+
+        first           = suffix_end;
+        is_first_number = false;
+    }
+
+    return total;
+}
+
 template <CLArgs::StdChronoDuration T>
 T
 CLArgs::parse_value(const std::string_view sv)
@@ -285,19 +493,236 @@ CLArgs::parse_value(const std::string_view sv)
         throw ParseValueException<T>(sv, "String cannot be empty");
     }
 
-    using UnderlyingValueType = typename T::rep;
+    using Rep    = typename T::rep;
+    using Period = typename T::period;
+
+    constexpr UnitSuffix target{"", static_cast<std::uint64_t>(Period::num), static_cast<std::uint64_t>(Period::den)};
+
+    // Unsigned reps keep the sign, so the number is rejected like a negative
+    // unsigned integer
+    const bool             negative = std::is_signed_v<Rep> && sv.starts_with('-');
+    const std::string_view quantity = negative ? sv.substr(1) : sv;
+
+    if constexpr (std::is_floating_point_v<Rep>)
+    {
+        const Rep value = parse_quantity<T, Rep>(sv, quantity, duration_suffixes, target);
+        return T{negative ? -value : value};
+    }
+    else
+    {
+        const std::uint64_t magnitude = parse_quantity<T, std::uint64_t>(sv, quantity, duration_suffixes, target);
+        const std::uint64_t limit     = static_cast<std::uint64_t>(std::numeric_limits<Rep>::max()) + (negative ? 1 : 0);
+
+        if (magnitude > limit)
+        {
+            throw ParseValueException<T>(sv, "Number out of range");
+        }
+
+        // Conversions to signed integers are modular, so this also gives the
+        // minimum of Rep
+        return T{static_cast<Rep>(negative ? std::uint64_t{0} - magnitude : magnitude)};
+    }
+}
+
+template <>
+inline CLArgs::ByteSize
+CLArgs::parse_value<CLArgs::ByteSize>(const std::string_view sv)
+{
+    if (sv.empty())
+    {
+        throw ParseValueException<ByteSize>(sv, "String cannot be empty");
+    }
+
+    return ByteSize{parse_quantity<ByteSize, std::uint64_t>(sv, sv, byte_size_suffixes, byte_size_suffixes.front())};
+}
+
+template <>
+inline CLArgs::Rate
+CLArgs::parse_value<CLArgs::Rate>(const std::string_view sv)
+{
+    if (sv.empty())
+    {
+        throw ParseValueException<Rate>(sv, "String cannot be empty");
+    }
+
+    const std::size_t separator = sv.find('/');
+    if (separator == std::string_view::npos)
+    {
+        throw ParseValueException<Rate>(sv, "Missing \"/\" and period");
+    }
+
+    constexpr UnitSuffix event{"", 1, 1};
+    constexpr UnitSuffix nanosecond{"", 1, 1'000'000'000};
+
+    Rate rate;
+    rate.count = parse_quantity<Rate, std::uint64_t>(sv, sv.substr(0, separator), count_suffixes, event);
+
+    // The count of the period may be left out, as in "10k/s", but not its unit
+    const std::string_view period = sv.substr(separator + 1);
+    if (period.empty() || !is_unit_character(period.back()))
+    {
+        throw ParseValueException<Rate>(sv, "Missing unit of the period");
+    }
+
+    if (const UnitSuffix *unit = find_unit_suffix(duration_suffixes, period); unit != nullptr)
+    {
+        rate.period_nanoseconds = scale_quantity<Rate>(sv, 1, *unit, nanosecond);
+    }
+    else
+    {
+        rate.period_nanoseconds = parse_quantity<Rate, std::uint64_t>(sv, period, duration_suffixes, nanosecond);
+    }
+
+    if (rate.period_nanoseconds == 0)
+    {
+        throw ParseValueException<Rate>(sv, "Period cannot be zero");
+    }
+
+    return rate;
+}
+
+template <CLArgs::TraitsParsableValue T>
+T
+CLArgs::parse_value(const std::string_view sv)
+{
+    T value{};
+    if (const ValueParseResult result = ValueTraits<T>::parse(sv, value); !result)
+    {
+        throw ParseValueException<T>(sv, describe_parse_error(result));
+    }
+    return value;
+}
+
+template <typename T>
+CLArgs::ValueParseResult
+CLArgs::try_parse_value(const std::string_view sv, T &out) noexcept
+{
+    if constexpr (TraitsParsableValue<T>)
+    {
+        return ValueTraits<T>::parse(sv, out);
+    }
+    else
+    {
+        try
+        {
+            out = parse_value<T>(sv);
+            return {};
+        }
+        catch (...)
+        {
+            return {ParseStatus::InvalidFormat, 0, {}};
+        }
+    }
+}
+
+template <typename Callback>
+std::size_t
+CLArgs::for_each_list_element(const std::string_view sv, Callback &&callback)
+{
+    std::size_t index = 0;
+    const char *first = sv.data();
+    const char *last  = sv.data() + sv.size();
+
+    // memchr is vectorized by the C library, so long lists are scanned a
+    // register at a time instead of a character at a time
+    while (true)
+    {
+        const auto *delimiter = static_cast<const char *>(std::memchr(first, list_delimiter, static_cast<std::size_t>(last - first)));
+        const char *end       = delimiter == nullptr ? last : delimiter;
+
+        callback(index, std::string_view(first, static_cast<std::size_t>(end - first)));
+        ++index;
+
+        if (delimiter == nullptr)
+        {
+            return index;
+        }
+        first = delimiter + 1;
+    }
+}
 
+template <typename ListType, typename ElementType>
+ElementType
+CLArgs::parse_list_element(const std::string_view sv, const std::size_t index, const std::string_view element)
+{
     try
     {
-        const UnderlyingValueType value = parse_value<UnderlyingValueType>(sv);
-        return T{std::move(value)};
+        return parse_value<ElementType>(element);
     }
-    catch (const ParseValueException<UnderlyingValueType> &e)
+    catch (const std::invalid_argument &e)
     {
-        throw ParseValueException<T>(sv, std::move(e.what()));
+        throw ParseValueException<ListType>(sv, "Element " + std::to_string(index) + ": " + e.what());
     }
 }
 
+template <CLArgs::StdArray T>
+T
+CLArgs::parse_value(const std::string_view sv)
+{
+    if (sv.empty())
+    {
+        throw ParseValueException<T>(sv, "String cannot be empty");
+    }
+
+    using ElementType = typename T::value_type;
+
+    constexpr std::size_t size = std::tuple_size_v<T>;
+
+    T                 values{};
+    const std::size_t count = for_each_list_element(sv,
+                                                    [&values, sv](const std::size_t index, const std::string_view element)
+                                                    {
+                                                        if (index < size)
+                                                        {
+                                                            values[index] = parse_list_element<T, ElementType>(sv, index, element);
+                                                        }
+                                                    });
+
+    if (count != size)
+    {
+        throw ParseValueException<T>(sv, "Expected " + std::to_string(size) + " elements, got " + std::to_string(count));
+    }
+
+    return values;
+}
+
+template <CLArgs::InlineVectorType T>
+T
+CLArgs::parse_value(const std::string_view sv)
+{
+    if (sv.empty())
+    {
+        throw ParseValueException<T>(sv, "String cannot be empty");
+    }
+
+    using ElementType = typename T::value_type;
+
+    T                 values;
+    const std::size_t count = for_each_list_element(sv,
+                                                    [&values, sv](const std::size_t index, const std::string_view element)
+                                                    {
+                                                        if (index < T::capacity())
+                                                        {
+                                                            values.push_back(parse_list_element<T, ElementType>(sv, index, element));
+                                                        }
+                                                    });
+
+    if (count > T::capacity())
+    {
+        throw ParseValueException<T>(sv,
+                                     "Expected at most " + std::to_string(T::capacity()) + " elements, got " + std::to_string(count));
+    }
+
+    return values;
+}
+
+template <typename T>
+T
+CLArgs::parse_value(const std::string_view sv, std::pmr::memory_resource *)
+{
+    return parse_value<T>(sv);
+}
+
 template <typename T>
 constexpr std::string_view
 CLArgs::pretty_string_of_type()
@@ -368,6 +793,13 @@ CLArgs::pretty_string_of_type<std::string>()
     return "string";
 }
 
+template <>
+constexpr std::string_view
+CLArgs::pretty_string_of_type<std::pmr::string>()
+{
+    return "string";
+}
+
 template <>
 constexpr std::string_view
 CLArgs::pretty_string_of_type<std::filesystem::path>()
@@ -425,4 +857,39 @@ CLArgs::pretty_string_of_type()
     }
 }
 
+template <>
+constexpr std::string_view
+CLArgs::pretty_string_of_type<CLArgs::ByteSize>()
+{
+    return "byte size";
+}
+
+template <>
+constexpr std::string_view
+CLArgs::pretty_string_of_type<CLArgs::Rate>()
+{
+    return "rate";
+}
+
+template <CLArgs::NamedValueTraits T>
+constexpr std::string_view
+CLArgs::pretty_string_of_type()
+{
+    return ValueTraits<T>::name;
+}
+
+template <CLArgs::StdArray T>
+constexpr std::string_view
+CLArgs::pretty_string_of_type()
+{
+    return "list";
+}
+
+template <CLArgs::InlineVectorType T>
+constexpr std::string_view
+CLArgs::pretty_string_of_type()
+{
+    return "list";
+}
+
 #endif // CLARGS_PARSE_VALUE_HPP
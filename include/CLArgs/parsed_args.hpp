@@ -0,0 +1,111 @@
+#ifndef CLARGS_PARSED_ARGS_HPP
+#define CLARGS_PARSED_ARGS_HPP
+
+#include <CLArgs/core.hpp>
+#include <CLArgs/value_container.hpp>
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CLArgs
+{
+    // Immutable snapshot of the result of Parser::parse(). It holds copies of
+    // the values and the program name, and concurrent reads need no
+    // synchronization. Share it between threads as
+    // std::shared_ptr<const ParsedArgs<...>>.
+    //
+    // It can outlive the parser and the arguments it parsed, with two limits:
+    //   - std::string_view values, also inside lists, still refer into the
+    //     arguments or the command-line buffer of the parser
+    //   - a snapshot taken with std::move(parser).snapshot() allocates from
+    //     the memory resource of the parser, which has to outlive it
+    //
+    // Aligned to a cache line so that, when heap allocated, it never shares a
+    // cache line with other data, like the reference count of a shared_ptr.
+    template <Parsable... Parsables>
+    class alignas(cache_line_size) ParsedArgs
+    {
+    public:
+        ParsedArgs(std::string_view program, const ValueContainer<Parsables...> &values);
+        ParsedArgs(std::string_view program, ValueContainer<Parsables...> &&values);
+
+        [[nodiscard]] std::string_view program() const noexcept;
+
+        template <CmdFlag Flag>
+        [[nodiscard]] bool has_flag() const noexcept
+            requires is_part_of_v<Flag, Parsables...>;
+
+        template <CmdOption Option>
+        [[nodiscard]] const std::optional<typename Option::ValueType> &get_option() const noexcept
+            requires is_part_of_v<Option, Parsables...>;
+
+        template <CmdOptionWithDefault Option>
+        [[nodiscard]] const typename Option::ValueType &get() const noexcept
+            requires is_part_of_v<Option, Parsables...>;
+
+        [[nodiscard]] const ValueContainer<Parsables...> &values() const noexcept;
+
+    private:
+        std::string                  program_;
+        ValueContainer<Parsables...> values_;
+    };
+} // namespace CLArgs
+
+template <CLArgs::Parsable... Parsables>
+CLArgs::ParsedArgs<Parsables...>::ParsedArgs(const std::string_view program, const ValueContainer<Parsables...> &values)
+    : program_{program}
+    , values_{values}
+{
+}
+
+template <CLArgs::Parsable... Parsables>
+CLArgs::ParsedArgs<Parsables...>::ParsedArgs(const std::string_view program, ValueContainer<Parsables...> &&values)
+    : program_{program}
+    , values_{std::move(values)}
+{
+}
+
+template <CLArgs::Parsable... Parsables>
+std::string_view
+CLArgs::ParsedArgs<Parsables...>::program() const noexcept
+{
+    return program_;
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::CmdFlag Flag>
+bool
+CLArgs::ParsedArgs<Parsables...>::has_flag() const noexcept
+    requires is_part_of_v<Flag, Parsables...>
+{
+    const auto &opt = values_.template get_value<Flag>();
+    return opt.has_value() && opt.value();
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::CmdOption Option>
+const std::optional<typename Option::ValueType> &
+CLArgs::ParsedArgs<Parsables...>::get_option() const noexcept
+    requires is_part_of_v<Option, Parsables...>
+{
+    return values_.template get_value<Option>();
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::CmdOptionWithDefault Option>
+const typename Option::ValueType &
+CLArgs::ParsedArgs<Parsables...>::get() const noexcept
+    requires is_part_of_v<Option, Parsables...>
+{
+    return *values_.template get_value<Option>();
+}
+
+template <CLArgs::Parsable... Parsables>
+const CLArgs::ValueContainer<Parsables...> &
+CLArgs::ParsedArgs<Parsables...>::values() const noexcept
+{
+    return values_;
+}
+
+#endif // CLARGS_PARSED_ARGS_HPP
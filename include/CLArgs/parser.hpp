@@ -1,150 +1,1079 @@
 #ifndef CLARGS_PARSER_HPP
 #define CLARGS_PARSER_HPP
 
+#include <CLArgs/argv.hpp>
+#include <CLArgs/binding.hpp>
+#include <CLArgs/command_line.hpp>
+#include <CLArgs/completion.hpp>
+#include <CLArgs/constraints.hpp>
 #include <CLArgs/core.hpp>
+#include <CLArgs/identifier_trie.hpp>
+#include <CLArgs/option_group.hpp>
 #include <CLArgs/parse_value.hpp>
+#include <CLArgs/parsed_args.hpp>
+#include <CLArgs/self_command_line.hpp>
+#include <CLArgs/suggestions.hpp>
+#include <CLArgs/utf8.hpp>
 #include <CLArgs/value_container.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <memory_resource>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <sstream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CLArgs
 {
-    template <typename Flags, typename Options, StringLiteral ProgramDescription>
+    // Outcome of Parser::feed() for a single token
+    enum class FeedResult
+    {
+        Consumed,    // The token was a flag, an option or an option value
+        Passthrough, // The token follows "--" and is left to the caller
+        Ignored,     // A terminating flag was seen before, the token is skipped
+    };
+
+    template <typename Flags, typename Options, StringLiteral ProgramDescription, typename Constraints = ConstraintList<>>
     class Parser;
 
-    template <CmdFlag... Flags, CmdOption... Options, StringLiteral ProgramDescription>
-    class Parser<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription>
+    template <CmdFlag... Flags, CmdOption... Options, StringLiteral ProgramDescription, ParserConstraint... Constraints>
+    class Parser<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription, ConstraintList<Constraints...>>
     {
     public:
-        Parser() noexcept = default;
-        ~Parser()         = default;
+        Parser() noexcept;
+        explicit Parser(std::pmr::memory_resource *resource) noexcept;
+        ~Parser() = default;
 
-        Parser(const Parser &)  = delete;
-        Parser(const Parser &&) = delete;
+        Parser(const Parser &) = delete;
+        Parser(Parser &&)      = delete;
 
-        Parser &operator=(const Parser &)  = delete;
-        Parser &operator=(const Parser &&) = delete;
+        Parser &operator=(const Parser &) = delete;
+        Parser &operator=(Parser &&)      = delete;
 
+        // A shell completion request, like "program --__complete --ver", is not
+        // parsed as arguments by any of the parse functions or feed(), see
+        // completion_requested()
         void parse(int argc, char **argv);
 
+        template <ArgumentRange Args>
+        std::ranges::borrowed_subrange_t<Args> parse(std::string_view program, Args &&args);
+
+        // Parses the command line of the process, see self_command_line(). The
+        // arguments are not copied, and the returned passthrough arguments
+        // remain valid until the process exits.
+        std::span<const std::string_view> parse_self();
+
+        // Like parse(), but converts the values of Bound flags and options
+        // straight into their members of config, and the parser only records
+        // which were given. Until the next parse(), get(), get_option(),
+        // snapshot(), to_argv() and serialize_values() throw std::logic_error
+        // for a bound option that was given. Bound flags are set to whether they were given,
+        // and bound options that were not given keep their member unless
+        // they have a default. If parsing fails, config may be partially
+        // written.
+        template <typename Config>
+            requires binds_to_v<Config, Flags..., Options...>
+        void parse_into(Config &config, int argc, char **argv);
+
+        template <typename Config, ArgumentRange Args>
+            requires binds_to_v<Config, Flags..., Options...>
+        std::ranges::borrowed_subrange_t<Args> parse_into(Config &config, std::string_view program, Args &&args);
+
+        // Tokens are unquoted into a buffer owned by the parser, which
+        // std::string_view option values, the returned passthrough tokens and
+        // snapshots of such values point into. They stay valid until the next
+        // call with a longer command line reallocates the buffer, or the
+        // parser is destroyed, whichever comes first. Copy them, or use the
+        // overload taking a buffer, to keep them longer.
+        std::ranges::borrowed_subrange_t<CommandLineTokenizer> parse_command_line(std::string_view program, std::string_view command_line);
+
+        // Like above, with the tokens unquoted into buffer, which must be at
+        // least as large as command_line and outlive the views into it
+        std::ranges::borrowed_subrange_t<CommandLineTokenizer> parse_command_line(std::string_view program,
+                                                                                  std::string_view command_line,
+                                                                                  std::span<char>  buffer);
+
+        // Push-style parsing for arguments that arrive one token at a time.
+        // Tokens are converted as they are fed and need not outlive feed(),
+        // except for std::string_view values, which refer to the token.
+        void       begin(std::string_view program);
+        FeedResult feed(std::string_view token);
+        void       finish();
+
+        // Accepts unambiguous prefixes of long options, e.g. --verb for --verbose,
+        // like GNU getopt_long(). Exact matches always take precedence.
+        void allow_abbreviations(bool allow = true) noexcept;
+
+        // Rejects string and path values, and lists of them, that are not
+        // well-formed UTF-8, before they reach code that assumes they are
+        void validate_utf8(bool validate = true) noexcept;
+
+        // Whether the last parse was a shell completion request. No
+        // values are parsed then, and the caller is expected to answer it with
+        // write_completions() and exit, like after a terminating flag.
+        [[nodiscard]] bool completion_requested() const noexcept;
+
+        // The identifiers completing the partial argument of the request
+        [[nodiscard]] std::span<const std::string_view> completions() const noexcept;
+
+        // Writes completions() one per line, as the completion scripts expect
+        void write_completions(std::FILE *stream = stdout) const noexcept;
+
         [[nodiscard]] std::string usage() const noexcept;
         [[nodiscard]] std::string help() const noexcept;
 
         [[nodiscard]] std::string_view program() const noexcept;
 
+        [[nodiscard]] std::span<char *> passthrough() const noexcept;
+
         template <CmdFlag Flag>
         [[nodiscard]] bool has_flag() const noexcept
             requires is_part_of_v<Flag, Flags...>;
 
         template <CmdOption Option>
-        [[nodiscard]] const std::optional<typename Option::ValueType> &get_option() const noexcept
+        [[nodiscard]] const std::optional<typename Option::ValueType> &get_option() const noexcept(!BoundParsable<Option>)
+            requires is_part_of_v<Option, Options...>;
+
+        template <CmdOptionWithDefault Option>
+        [[nodiscard]] const typename Option::ValueType &get() const noexcept(!BoundParsable<Option>)
             requires is_part_of_v<Option, Options...>;
 
+        // The values of a group added with ParserBuilder::add_group()
+        template <CmdOptionGroup Group>
+        [[nodiscard]] OptionGroupView<Group> group() const noexcept
+            requires group_part_of_v<Group, Flags..., Options...>;
+
+        [[nodiscard]] ParsedArgs<Flags..., Options...> snapshot() const &;
+        [[nodiscard]] ParsedArgs<Flags..., Options...> snapshot() &&;
+
+        [[nodiscard]] std::pmr::vector<std::byte> serialize_values() const;
+        void                                      deserialize_values(std::string_view program, std::span<const std::byte> blob);
+
+        template <typename... Overrides>
+        [[nodiscard]] Argv to_argv(const Overrides &...overrides) const;
+
     private:
-        template <Parsable This, Parsable... Rest>
-        void parse_arg(auto &remaining_args);
+        template <std::forward_iterator Iter, std::sentinel_for<Iter> Sentinel>
+        std::ranges::subrange<Iter, Sentinel> parse_args(std::ranges::subrange<Iter, Sentinel> remaining_args);
+
+        // Each of these finds the Parsable of arg in identifier_trie_, and
+        // calls the function for that Parsable from a table indexed by target
+        void parse_arg(std::string_view arg, auto &remaining_args);
+        bool scan_arg_for_terminating_flag(std::string_view arg, auto &remaining_args);
+        void feed_arg(std::string_view arg);
+
+        template <Parsable This, typename Args>
+        void parse_parsable(std::string_view arg, Args &remaining_args);
+
+        template <Parsable This, typename Args>
+        bool scan_parsable(std::string_view arg, Args &remaining_args);
+
+        template <Parsable This>
+        void feed_parsable(std::string_view arg);
+
+        template <Parsable This>
+        void check_not_duplicate() const;
+
+        template <CmdOption This>
+        void store_option_value(std::string_view identifier, std::string_view value_arg);
+
+        template <CmdOption This>
+        void store_bound_option_value(std::string_view identifier, std::string_view value_arg);
+
+        template <typename Config>
+        void assign_bound_values(Config &config) const;
+
+        // Throws std::logic_error if the value of This was converted into a
+        // member by parse_into(), and is therefore not held by the parser
+        template <CmdOption This>
+        void check_value_held(std::string_view operation) const;
+
+        void check_values_held(std::string_view operation) const;
+
+        [[nodiscard]] std::int32_t     find_abbreviation(std::string_view arg) const noexcept;
+        [[nodiscard]] std::string_view expand_abbreviation(std::string_view arg) const;
 
         template <Parsable This, Parsable... Rest>
         static constexpr void append_option_descriptions_to_usage(std::stringstream &);
 
         std::string_view                     program_;
-        ValueContainer<Flags..., Options...> values_{};
+        std::span<char *>                    passthrough_{};
+        std::optional<std::string_view>      completion_partial_; // Set by a completion request
+        std::pmr::string                     command_line_buffer_;
+        ValueContainer<Flags..., Options...> values_;
+        bool                                 abbreviations_{false};
+        bool                                 utf8_validation_{false};
+        void                                *bind_target_{nullptr}; // The Config of parse_into(), while it runs
+
+        enum class PushState
+        {
+            Idle,
+            ExpectingFirstArgument, // Which may be a completion request
+            ExpectingArgument,
+            ExpectingPartial,       // The partial argument of a completion request
+            ExpectingValue,
+            PassingThrough,
+            Terminated,
+        };
 
+        PushState        push_state_{PushState::Idle};
+        std::string_view pending_identifier_;
+        void (Parser::*pending_option_)(std::string_view, std::string_view){nullptr};
+
+        static constexpr std::size_t parsable_count_{sizeof...(Flags) + sizeof...(Options)};
         static constexpr std::size_t max_identifier_length_{max_identifier_list_length<Flags..., Options...>()};
+        static constexpr auto        completion_table_{sorted_identifier_table<Flags..., Options...>()};
+        static constexpr auto        identifier_trie_{make_identifier_trie<Flags..., Options...>()};
+        static constexpr auto        canonical_identifiers_{canonical_identifiers<Flags..., Options...>()};
     };
 } // namespace CLArgs
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::Parser() noexcept
+    : Parser(std::pmr::get_default_resource())
+{
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::Parser(std::pmr::memory_resource *resource) noexcept
+    : command_line_buffer_{resource}
+    , values_{resource}
+{
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 void
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::parse(int argc, char **argv)
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse(int argc, char **argv)
 {
     if (argv == nullptr || *argv == nullptr)
     {
         throw std::invalid_argument("Passing nullptr to Parser::parse() is not allowed");
     }
 
-    program_ = *argv++;
+    program_            = *argv++;
+    passthrough_        = {};
+    completion_partial_ = std::nullopt;
+    values_.reset();
     argc -= 1;
 
-    for (auto remaining_args = std::views::counted(argv, argc); !remaining_args.empty();)
+    const auto passthrough = parse_args(std::ranges::subrange(argv, argv + argc));
+    passthrough_           = std::span<char *>(passthrough.begin(), passthrough.end());
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::ArgumentRange Args>
+std::ranges::borrowed_subrange_t<Args>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse(const std::string_view program, Args &&args)
+{
+    program_            = program;
+    passthrough_        = {};
+    completion_partial_ = std::nullopt;
+    values_.reset();
+
+    const auto passthrough = parse_args(std::ranges::subrange(std::ranges::begin(args), std::ranges::end(args)));
+
+    if constexpr (std::ranges::borrowed_range<Args>)
+    {
+        return {passthrough.begin(), std::ranges::next(passthrough.begin(), passthrough.end())};
+    }
+    else
     {
-        parse_arg<Flags..., Options...>(remaining_args);
+        return std::ranges::dangling{};
     }
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
-template <CLArgs::Parsable This, CLArgs::Parsable... Rest>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::span<const std::string_view>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_self()
+{
+    const std::span<const std::string_view> arguments = self_command_line();
+    if (arguments.empty())
+    {
+        throw std::runtime_error("Command line of the process is empty");
+    }
+
+    const auto passthrough = parse(arguments.front(), arguments.subspan(1));
+    return {passthrough.begin(), passthrough.end()};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <typename Config>
+    requires CLArgs::binds_to_v<Config, Flags..., Options...>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_into(Config &config, int argc, char **argv)
+{
+    bind_target_ = &config;
+    try
+    {
+        parse(argc, argv);
+    }
+    catch (...)
+    {
+        bind_target_ = nullptr;
+        throw;
+    }
+    bind_target_ = nullptr;
+
+    assign_bound_values(config);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <typename Config, CLArgs::ArgumentRange Args>
+    requires CLArgs::binds_to_v<Config, Flags..., Options...>
+std::ranges::borrowed_subrange_t<Args>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_into(Config &config, const std::string_view program, Args &&args)
+{
+    bind_target_ = &config;
+    try
+    {
+        const auto passthrough = parse(program, std::forward<Args>(args));
+        bind_target_           = nullptr;
+
+        assign_bound_values(config);
+        return passthrough;
+    }
+    catch (...)
+    {
+        bind_target_ = nullptr;
+        throw;
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::ranges::borrowed_subrange_t<CLArgs::CommandLineTokenizer>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_command_line(const std::string_view program,
+                                                                           const std::string_view command_line)
+{
+    // The buffer is kept between calls, so only a command line longer than
+    // any seen before causes an allocation
+    if (command_line_buffer_.size() < command_line.size())
+    {
+        command_line_buffer_.resize(command_line.size());
+    }
+
+    return parse_command_line(program, command_line, command_line_buffer_);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::ranges::borrowed_subrange_t<CLArgs::CommandLineTokenizer>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_command_line(const std::string_view program,
+                                                                           const std::string_view command_line,
+                                                                           const std::span<char>  buffer)
+{
+    return parse(program, CommandLineTokenizer{command_line, buffer});
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::begin(const std::string_view program)
+{
+    program_            = program;
+    passthrough_        = {};
+    completion_partial_ = std::nullopt;
+    values_.reset();
+
+    push_state_         = PushState::ExpectingFirstArgument;
+    pending_identifier_ = {};
+    pending_option_     = nullptr;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+CLArgs::FeedResult
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::feed(const std::string_view token)
+{
+    // Unlike parse(), terminating flags cannot be found ahead of time here.
+    // Errors in tokens fed before one are reported, everything after it is ignored.
+    switch (push_state_)
+    {
+    case PushState::Idle:
+        throw std::logic_error("Parser::feed() must be preceded by Parser::begin()");
+
+    case PushState::ExpectingFirstArgument:
+        if (token == completion_request_identifier)
+        {
+            completion_partial_ = std::string_view{};
+            push_state_         = PushState::ExpectingPartial;
+            return FeedResult::Consumed;
+        }
+        push_state_ = PushState::ExpectingArgument;
+        [[fallthrough]];
+
+    case PushState::ExpectingArgument:
+        if (token == end_of_options_identifier)
+        {
+            push_state_ = PushState::PassingThrough;
+        }
+        else
+        {
+            feed_arg(token);
+        }
+        return FeedResult::Consumed;
+
+    case PushState::ExpectingValue:
+        // Switch state first, so a value that fails to parse does not leave
+        // the parser waiting for it
+        push_state_ = PushState::ExpectingArgument;
+        (this->*pending_option_)(pending_identifier_, token);
+        return FeedResult::Consumed;
+
+    case PushState::ExpectingPartial:
+        // Like after a terminating flag, the rest is not looked at
+        completion_partial_ = token;
+        push_state_         = PushState::Terminated;
+        return FeedResult::Consumed;
+
+    case PushState::PassingThrough:
+        return FeedResult::Passthrough;
+
+    case PushState::Terminated:
+        return FeedResult::Ignored;
+    }
+
+    return FeedResult::Ignored;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::finish()
+{
+    const PushState state = std::exchange(push_state_, PushState::Idle);
+
+    if (state == PushState::Idle)
+    {
+        throw std::logic_error("Parser::finish() must be preceded by Parser::begin()");
+    }
+
+    if (state == PushState::ExpectingValue)
+    {
+        std::stringstream ss;
+        ss << "Expected value for option \"" << pending_identifier_ << "\"";
+        throw std::invalid_argument(ss.str());
+    }
+
+    // After a terminating flag or a completion request, the rest of the
+    // command line was never looked at
+    if (state != PushState::Terminated && !completion_partial_)
+    {
+        check_constraints<Constraints...>(values_);
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <std::forward_iterator Iter, std::sentinel_for<Iter> Sentinel>
+std::ranges::subrange<Iter, Sentinel>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_args(std::ranges::subrange<Iter, Sentinel> remaining_args)
+{
+    // Shell completion is answered before any value is parsed, so a TAB press
+    // never pays for more than a lookup in the compile-time identifier table
+    if (!remaining_args.empty() && std::string_view{remaining_args.front()} == completion_request_identifier)
+    {
+        remaining_args.advance(1);
+        completion_partial_ = remaining_args.empty() ? std::string_view{} : std::string_view{remaining_args.front()};
+        return {std::ranges::next(remaining_args.begin(), remaining_args.end()), remaining_args.end()};
+    }
+
+    if constexpr ((TerminatingFlag<Flags> || ...))
+    {
+        // Terminating flags are located before any value is converted, so that
+        // e.g. --help works regardless of what else is on the command line
+        for (auto scan_args = remaining_args; !scan_args.empty() && std::string_view{scan_args.front()} != end_of_options_identifier;)
+        {
+            const std::string_view arg = scan_args.front();
+            scan_args.advance(1);
+
+            if (scan_arg_for_terminating_flag(arg, scan_args))
+            {
+                return {std::ranges::next(remaining_args.begin(), remaining_args.end()), remaining_args.end()};
+            }
+        }
+    }
+
+    while (!remaining_args.empty())
+    {
+        if (std::string_view{remaining_args.front()} == end_of_options_identifier)
+        {
+            remaining_args.advance(1);
+            break;
+        }
+
+        const std::string_view arg = remaining_args.front();
+        remaining_args.advance(1);
+
+        parse_arg(arg, remaining_args);
+    }
+
+    check_constraints<Constraints...>(values_);
+
+    return remaining_args;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_arg(const std::string_view arg, auto &remaining_args)
+{
+    using Args = std::remove_reference_t<decltype(remaining_args)>;
+
+    static constexpr std::array<void (Parser::*)(std::string_view, Args &), parsable_count_> handlers{
+        &Parser::parse_parsable<Flags, Args>...,
+        &Parser::parse_parsable<Options, Args>...,
+    };
+
+    if (const std::int32_t target = identifier_trie_.find(arg); target >= 0)
+    {
+        (this->*handlers[static_cast<std::size_t>(target)])(arg, remaining_args);
+    }
+    else if (const std::string_view expanded = expand_abbreviation(arg); !expanded.empty())
+    {
+        parse_arg(expanded, remaining_args);
+    }
+    else
+    {
+        throw UnknownOptionException(arg, completion_table_);
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::Parsable This, typename Args>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::parse_parsable(const std::string_view arg, Args &remaining_args)
+{
+    check_not_duplicate<This>();
+
+    // This assertion is here for future-proofing. If the definition of
+    // Parsable is updated, this logic must also be updated
+    static_assert(CmdFlag<This> || CmdOption<This>);
+
+    if constexpr (CmdFlag<This>)
+    {
+        values_.template set_value<This>(true);
+    }
+    else if constexpr (CmdOption<This>)
+    {
+        if (remaining_args.empty())
+        {
+            std::stringstream ss;
+            ss << "Expected value for option \"" << arg << "\"";
+            throw std::invalid_argument(ss.str());
+        }
+
+        const std::string_view value_arg = remaining_args.front();
+        remaining_args.advance(1);
+
+        store_option_value<This>(arg, value_arg);
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::feed_arg(const std::string_view arg)
+{
+    static constexpr std::array<void (Parser::*)(std::string_view), parsable_count_> handlers{
+        &Parser::feed_parsable<Flags>...,
+        &Parser::feed_parsable<Options>...,
+    };
+
+    if (const std::int32_t target = identifier_trie_.find(arg); target >= 0)
+    {
+        (this->*handlers[static_cast<std::size_t>(target)])(arg);
+    }
+    else if (const std::string_view expanded = expand_abbreviation(arg); !expanded.empty())
+    {
+        feed_arg(expanded);
+    }
+    else
+    {
+        throw UnknownOptionException(arg, completion_table_);
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::Parsable This>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::feed_parsable(const std::string_view arg)
+{
+    check_not_duplicate<This>();
+
+    static_assert(CmdFlag<This> || CmdOption<This>);
+
+    if constexpr (CmdFlag<This>)
+    {
+        values_.template set_value<This>(true);
+
+        if constexpr (TerminatingFlag<This>)
+        {
+            push_state_ = PushState::Terminated;
+        }
+    }
+    else if constexpr (CmdOption<This>)
+    {
+        // The identifier refers to static storage, so it outlives the token
+        pending_identifier_ = *std::ranges::find(This::identifiers, arg);
+        pending_option_     = &Parser::store_option_value<This>;
+        push_state_         = PushState::ExpectingValue;
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::int32_t
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::find_abbreviation(const std::string_view arg) const noexcept
+{
+    if (!abbreviations_ || !is_long_identifier(arg))
+    {
+        return identifier_trie_.no_target;
+    }
+    return identifier_trie_.find_prefix(arg);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::string_view
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::expand_abbreviation(const std::string_view arg) const
+{
+    const std::int32_t target = find_abbreviation(arg);
+
+    if (target == identifier_trie_.ambiguous_target)
+    {
+        std::stringstream ss;
+        ss << "Ambiguous option \"" << arg << "\", could be ";
+
+        const auto candidates = complete(completion_table_, arg);
+        for (auto iter = candidates.begin(); iter != candidates.end(); ++iter)
+        {
+            ss << (iter == candidates.begin() ? "" : ", ") << *iter;
+        }
+        throw std::invalid_argument(ss.str());
+    }
+
+    return target >= 0 ? canonical_identifiers_[target] : std::string_view{};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::Parsable This>
 void
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::parse_arg(auto &remaining_args)
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::check_not_duplicate() const
 {
-    const auto arg = remaining_args.front();
+    if (values_.template is_set<This>())
+    {
+        std::stringstream ss;
+        ss << "Duplicate argument \"" << This::identifiers[0] << "\"";
+        throw std::invalid_argument(ss.str());
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOption This>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::store_option_value(const std::string_view identifier,
+                                                                           const std::string_view value_arg)
+{
+    using ValueType = typename This::ValueType;
+
+    if constexpr (Utf8ValidatedValue<ValueType>)
+    {
+        // The value is left out of the message, as it is what should not be
+        // passed on
+        if (const std::size_t offset = utf8_validation_ ? find_invalid_utf8(value_arg) : value_arg.size(); offset != value_arg.size())
+        {
+            std::stringstream ss;
+            ss << "Invalid UTF-8 in value for option \"" << identifier << "\" at offset " << offset;
+            throw std::invalid_argument(ss.str());
+        }
+    }
+
+    if constexpr (BoundParsable<This>)
+    {
+        if (bind_target_ != nullptr)
+        {
+            store_bound_option_value<This>(identifier, value_arg);
+            return;
+        }
+    }
 
-    if (std::ranges::find(This::identifiers, arg) != This::identifiers.end())
+    if constexpr (TraitsParsableValue<ValueType>)
     {
-        remaining_args = std::views::drop(remaining_args, 1);
+        // Parsed in place, and nothing is thrown unless the value is invalid
+        if (const ValueParseResult result = ValueTraits<ValueType>::parse(value_arg, values_.template emplace_value<This>()); !result)
+        {
+            values_.template reset_value<This>();
 
-        if (values_.template get_value<This>() != std::nullopt)
+            std::stringstream ss;
+            ss << "Failed to parse value for option \"" << identifier
+               << "\": " << ParseValueException<ValueType>(value_arg, describe_parse_error(result)).what();
+            throw std::invalid_argument(ss.str());
+        }
+    }
+    else
+    {
+        try
+        {
+            values_.template set_value<This>(parse_value<ValueType>(value_arg, values_.resource()));
+        }
+        catch (std::exception &e)
         {
             std::stringstream ss;
-            ss << "Duplicate argument \"" << This::identifiers[0] << "\"";
+            ss << "Failed to parse value for option \"" << identifier << "\": " << e.what();
             throw std::invalid_argument(ss.str());
         }
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOption This>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::store_bound_option_value(const std::string_view identifier,
+                                                                                 const std::string_view value_arg)
+{
+    using ValueType = typename This::ValueType;
 
-        // This assertion is here for future-proofing. If the definition of
-        // Parsable is updated, this logic must also be updated
-        static_assert(CmdFlag<This> || CmdOption<This>);
+    // The value is converted straight into the member, and the ValueContainer
+    // only records that the option was given
+    ValueType &member = static_cast<typename This::Config *>(bind_target_)->*This::target;
 
-        if constexpr (CmdFlag<This>)
+    if constexpr (TraitsParsableValue<ValueType>)
+    {
+        member = ValueType{};
+        if (const ValueParseResult result = ValueTraits<ValueType>::parse(value_arg, member); !result)
         {
-            values_.template set_value<This>(true);
+            std::stringstream ss;
+            ss << "Failed to parse value for option \"" << identifier
+               << "\": " << ParseValueException<ValueType>(value_arg, describe_parse_error(result)).what();
+            throw std::invalid_argument(ss.str());
         }
-        else if constexpr (CmdOption<This>)
+    }
+    else
+    {
+        try
         {
-            if (remaining_args.empty())
+            // Allocator-aware members are given a value in their own resource,
+            // so moving it in does not copy it again
+            if constexpr (requires { member.get_allocator().resource(); })
             {
-                std::stringstream ss;
-                ss << "Expected value for option \"" << arg << "\"";
-                throw std::invalid_argument(ss.str());
+                member = parse_value<ValueType>(value_arg, member.get_allocator().resource());
             }
+            else
+            {
+                member = parse_value<ValueType>(value_arg, values_.resource());
+            }
+        }
+        catch (std::exception &e)
+        {
+            std::stringstream ss;
+            ss << "Failed to parse value for option \"" << identifier << "\": " << e.what();
+            throw std::invalid_argument(ss.str());
+        }
+    }
 
-            const auto value_arg = remaining_args.front();
-            remaining_args       = std::views::drop(remaining_args, 1);
+    values_.template mark_set<This>();
+}
 
-            try
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <typename Config>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::assign_bound_values(Config &config) const
+{
+    const auto assign = [this, &config]<Parsable P>()
+    {
+        if constexpr (BoundParsable<P> && !CmdOption<P>)
+        {
+            config.*P::target = values_.template is_set<P>();
+        }
+        else if constexpr (BoundParsable<P> && CmdOptionWithDefault<P>)
+        {
+            auto &member = config.*P::target;
+            if (values_.template is_set<P>())
+            {
+                return;
+            }
+
+            if constexpr (requires { member.get_allocator(); })
             {
-                const auto value = parse_value<typename This::ValueType>(value_arg);
-                values_.template set_value<This>(value);
+                member = make_default_value<P>(member.get_allocator());
             }
-            catch (std::exception &e)
+            else
             {
-                std::stringstream ss;
-                ss << "Failed to parse value for option \"" << arg << "\": " << e.what();
-                throw std::invalid_argument(ss.str());
+                member = make_default_value<P>(std::pmr::polymorphic_allocator<>{values_.resource()});
             }
         }
+    };
+
+    (assign.template operator()<Flags>(), ...);
+    (assign.template operator()<Options>(), ...);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOption This>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::check_value_held(const std::string_view operation) const
+{
+    if (values_.template has_external_value<This>())
+    {
+        std::stringstream ss;
+        ss << operation << " cannot be used for option \"" << This::identifiers.front()
+           << "\" after parse_into(), its value is only held by the config struct";
+        throw std::logic_error(ss.str());
+    }
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::check_values_held(const std::string_view operation) const
+{
+    (check_value_held<Options>(operation), ...);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+bool
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::scan_arg_for_terminating_flag(const std::string_view arg, auto &remaining_args)
+{
+    using Args = std::remove_reference_t<decltype(remaining_args)>;
+
+    static constexpr std::array<bool (Parser::*)(std::string_view, Args &), parsable_count_> handlers{
+        &Parser::scan_parsable<Flags, Args>...,
+        &Parser::scan_parsable<Options, Args>...,
+    };
 
-        return;
+    if (const std::int32_t target = identifier_trie_.find(arg); target >= 0)
+    {
+        return (this->*handlers[static_cast<std::size_t>(target)])(arg, remaining_args);
+    }
+    if (const std::int32_t target = find_abbreviation(arg); target >= 0)
+    {
+        return (this->*handlers[static_cast<std::size_t>(target)])(canonical_identifiers_[target], remaining_args);
     }
 
-    if constexpr (sizeof...(Rest) > 0)
+    // Unknown and ambiguous arguments are reported by the regular parsing pass
+    return false;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::Parsable This, typename Args>
+bool
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::scan_parsable(const std::string_view, Args &remaining_args)
+{
+    if constexpr (TerminatingFlag<This>)
     {
-        parse_arg<Rest...>(remaining_args);
+        values_.template set_value<This>(true);
+        return true;
     }
-    else
+    else if constexpr (CmdOption<This>)
     {
-        std::stringstream ss;
-        ss << "Unknown option \"" << arg << "\"";
-        throw std::invalid_argument(ss.str());
+        // Skip the value without converting it, it might look like a flag
+        if (!remaining_args.empty())
+        {
+            remaining_args.advance(1);
+        }
     }
+
+    return false;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::allow_abbreviations(const bool allow) noexcept
+{
+    abbreviations_ = allow;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::validate_utf8(const bool validate) noexcept
+{
+    utf8_validation_ = validate;
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 std::string
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::usage() const noexcept
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::usage() const noexcept
 {
     std::stringstream ss;
     ss << "Usage: " << program_;
@@ -155,9 +1084,15 @@ CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>,
     return ss.str();
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 std::string
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::help() const noexcept
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::help() const noexcept
 {
     std::stringstream ss;
     if constexpr (!std::string_view(ProgramDescription.value).empty())
@@ -171,17 +1106,92 @@ CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>,
     return ss.str();
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+bool
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::completion_requested() const noexcept
+{
+    return completion_partial_.has_value();
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::span<const std::string_view>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::completions() const noexcept
+{
+    if (!completion_partial_)
+    {
+        return {};
+    }
+    return complete(completion_table_, *completion_partial_);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::write_completions(std::FILE *const stream) const noexcept
+{
+    for (const std::string_view candidate : completions())
+    {
+        std::fwrite(candidate.data(), 1, candidate.size(), stream);
+        std::fputc('\n', stream);
+    }
+    std::fflush(stream);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 std::string_view
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::program() const noexcept
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::program() const noexcept
 {
     return program_;
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::span<char *>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::passthrough() const noexcept
+{
+    // This is a view into the argv passed to parse(). As argv is terminated by
+    // a nullptr, passthrough().data() can be handed directly to execv()
+    return passthrough_;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::CmdFlag Flag>
 bool
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::has_flag() const noexcept
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::has_flag() const noexcept
     requires is_part_of_v<Flag, Flags...>
 {
     const auto opt    = values_.template get_value<Flag>();
@@ -189,20 +1199,149 @@ CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>,
     return result;
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::CmdOption Option>
 const std::optional<typename Option::ValueType> &
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::get_option() const noexcept
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::get_option() const noexcept(!BoundParsable<Option>)
     requires is_part_of_v<Option, Options...>
 {
+    if constexpr (BoundParsable<Option>)
+    {
+        check_value_held<Option>("get_option()");
+    }
     return values_.template get_value<Option>();
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOptionWithDefault Option>
+const typename Option::ValueType &
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::get() const noexcept(!BoundParsable<Option>)
+    requires is_part_of_v<Option, Options...>
+{
+    if constexpr (BoundParsable<Option>)
+    {
+        check_value_held<Option>("get()");
+    }
+
+    // Options with a default always hold a value, so no presence check is needed
+    return *values_.template get_value<Option>();
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOptionGroup Group>
+CLArgs::OptionGroupView<Group>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::group() const noexcept
+    requires group_part_of_v<Group, Flags..., Options...>
+{
+    return OptionGroupView<Group>{values_};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+CLArgs::ParsedArgs<Flags..., Options...>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::snapshot() const &
+{
+    check_values_held("snapshot()");
+
+    return {program_, values_};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+CLArgs::ParsedArgs<Flags..., Options...>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::snapshot() &&
+{
+    check_values_held("snapshot()");
+
+    // The values are moved out and keep the memory resource of the parser,
+    // which therefore has to outlive the snapshot
+    return {program_, std::move(values_)};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+std::pmr::vector<std::byte>
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::serialize_values() const
+{
+    return values_.serialize();
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+void
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::deserialize_values(const std::string_view           program,
+                                                                           const std::span<const std::byte> blob)
+{
+    // Lets e.g. forked workers pick up the values parsed by their parent
+    // without parsing the same arguments again
+    values_.deserialize(blob);
+    program_            = program;
+    passthrough_        = {};
+    completion_partial_ = std::nullopt;
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <typename... Overrides>
+CLArgs::Argv
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::to_argv(const Overrides &...overrides) const
+{
+    return CLArgs::to_argv(program_, values_, overrides...);
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::Parsable This, CLArgs::Parsable... Rest>
 constexpr void
-CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::append_option_descriptions_to_usage(
-    std::stringstream &ss)
+CLArgs::Parser<CLArgs::CmdFlagList<Flags...>,
+               CLArgs::CmdOptionList<Options...>,
+               ProgramDescription,
+               CLArgs::ConstraintList<Constraints...>>::append_option_descriptions_to_usage(std::stringstream &ss)
 {
     constexpr std::size_t calculated_padding = max_identifier_length_ - identifier_list_length<This>() + 4;
 
@@ -217,7 +1356,27 @@ CLArgs::Parser<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>,
         }
     }
 
-    ss << std::setw(calculated_padding) << "  " << This::description << '\n';
+    ss << std::setw(calculated_padding) << "  " << This::description;
+
+    if constexpr (CmdOptionWithDefault<This>)
+    {
+        using DefaultType = std::remove_cv_t<decltype(This::default_value)>;
+
+        if constexpr (is_string_literal_v<DefaultType>)
+        {
+            ss << " (default: " << This::default_value.value << ")";
+        }
+        else if constexpr (std::is_same_v<DefaultType, bool>)
+        {
+            ss << " (default: " << std::boolalpha << This::default_value << std::noboolalpha << ")";
+        }
+        else if constexpr (requires { ss << This::default_value; })
+        {
+            ss << " (default: " << This::default_value << ")";
+        }
+    }
+
+    ss << '\n';
 
     if constexpr (sizeof...(Rest) > 0)
     {
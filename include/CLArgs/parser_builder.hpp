@@ -1,16 +1,23 @@
 #ifndef CLARGS_PARSER_BUILDER_HPP
 #define CLARGS_PARSER_BUILDER_HPP
 
+#include <CLArgs/constraints.hpp>
 #include <CLArgs/core.hpp>
+#include <CLArgs/option_group.hpp>
 #include <CLArgs/parser.hpp>
 
+#include <memory_resource>
+
 namespace CLArgs
 {
-    template <typename Flags = CmdFlagList<>, typename Options = CmdOptionList<>, StringLiteral ProgramDescription = "">
+    template <typename Flags                   = CmdFlagList<>,
+              typename Options                 = CmdOptionList<>,
+              StringLiteral ProgramDescription = "",
+              typename Constraints             = ConstraintList<>>
     class ParserBuilder;
 
-    template <CmdFlag... Flags, CmdOption... Options, StringLiteral ProgramDescription>
-    class ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription>
+    template <CmdFlag... Flags, CmdOption... Options, StringLiteral ProgramDescription, ParserConstraint... Constraints>
+    class ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription, ConstraintList<Constraints...>>
     {
     public:
         template <CmdFlag NewFlag>
@@ -19,44 +26,128 @@ namespace CLArgs
         template <CmdOption NewOption>
         [[nodiscard]] consteval auto add_option();
 
+        // Adds every flag and option of NewGroup, and of its nested groups,
+        // with the identifiers in the namespace of the group
+        template <CmdOptionGroup NewGroup>
+        [[nodiscard]] consteval auto add_group();
+
         template <StringLiteral NewProgramDescription>
         [[nodiscard]] consteval auto add_program_description();
 
+        // Members of NewConstraint must have been added before
+        template <ParserConstraint NewConstraint>
+        [[nodiscard]] consteval auto add_constraint();
+
         [[nodiscard]] constexpr auto build();
+        [[nodiscard]] constexpr auto build(std::pmr::memory_resource *resource);
     };
 } // namespace CLArgs
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::CmdFlag NewFlag>
 consteval auto
-CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::add_flag()
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::add_flag()
 {
     static_assert(!is_part_of_v<NewFlag, Flags...>, "Flag has already been added to builder");
-    return ParserBuilder<CmdFlagList<Flags..., NewFlag>, CmdOptionList<Options...>, ProgramDescription>{};
+    return ParserBuilder<CmdFlagList<Flags..., NewFlag>, CmdOptionList<Options...>, ProgramDescription, ConstraintList<Constraints...>>{};
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::CmdOption NewOption>
 consteval auto
-CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::add_option()
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::add_option()
 {
     static_assert(!is_part_of_v<NewOption, Options...>, "Option has already been added to builder");
-    return ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options..., NewOption>, ProgramDescription>{};
+    return ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options..., NewOption>, ProgramDescription, ConstraintList<Constraints...>>{};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::CmdOptionGroup NewGroup>
+consteval auto
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::add_group()
+{
+    static_assert(!group_part_of_v<NewGroup, Flags..., Options...>, "Option group has already been added to builder");
+    return ParserBuilder<concat_tuples_t<CmdFlagList<Flags...>, typename NewGroup::FlagList>,
+                         concat_tuples_t<CmdOptionList<Options...>, typename NewGroup::OptionList>,
+                         ProgramDescription,
+                         ConstraintList<Constraints...>>{};
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 template <CLArgs::StringLiteral NewProgramDescription>
 consteval auto
-CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::add_program_description()
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::add_program_description()
+{
+    return ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options...>, NewProgramDescription, ConstraintList<Constraints...>>{};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+template <CLArgs::ParserConstraint NewConstraint>
+consteval auto
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::add_constraint()
+{
+    static_assert(constraint_members_part_of_v<NewConstraint, Flags..., Options...>, "Constraint refers to an unknown flag or option");
+    static_assert(!is_part_of_v<NewConstraint, Constraints...>, "Constraint has already been added to builder");
+    return ParserBuilder<CmdFlagList<Flags...>,
+                         CmdOptionList<Options...>,
+                         ProgramDescription,
+                         ConstraintList<Constraints..., NewConstraint>>{};
+}
+
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
+constexpr auto
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::build()
 {
-    return ParserBuilder<CmdFlagList<Flags...>, CmdOptionList<Options...>, NewProgramDescription>{};
+    return Parser<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription, ConstraintList<Constraints...>>{};
 }
 
-template <CLArgs::CmdFlag... Flags, CLArgs::CmdOption... Options, CLArgs::StringLiteral ProgramDescription>
+template <CLArgs::CmdFlag... Flags,
+          CLArgs::CmdOption... Options,
+          CLArgs::StringLiteral ProgramDescription,
+          CLArgs::ParserConstraint... Constraints>
 constexpr auto
-CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>, CLArgs::CmdOptionList<Options...>, ProgramDescription>::build()
+CLArgs::ParserBuilder<CLArgs::CmdFlagList<Flags...>,
+                      CLArgs::CmdOptionList<Options...>,
+                      ProgramDescription,
+                      CLArgs::ConstraintList<Constraints...>>::build(std::pmr::memory_resource *resource)
 {
-    return Parser<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription>{};
+    return Parser<CmdFlagList<Flags...>, CmdOptionList<Options...>, ProgramDescription, ConstraintList<Constraints...>>{resource};
 }
 
 #endif // CLARGS_PARSER_BUILDER_HPP
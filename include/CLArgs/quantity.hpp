@@ -0,0 +1,187 @@
+#ifndef CLARGS_QUANTITY_HPP
+#define CLARGS_QUANTITY_HPP
+
+#include <array>
+#include <chrono>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <string_view>
+
+namespace CLArgs
+{
+    // A unit suffix and its size as the fraction numerator / denominator of
+    // the base unit of its table
+    struct UnitSuffix
+    {
+        std::string_view suffix;
+        std::uint64_t    numerator{1};
+        std::uint64_t    denominator{1};
+    };
+
+    // Base unit: one second
+    inline constexpr std::array duration_suffixes{
+        UnitSuffix{"ns", 1, 1'000'000'000},
+        UnitSuffix{"us", 1, 1'000'000},
+        UnitSuffix{"µs", 1, 1'000'000},
+        UnitSuffix{"ms", 1, 1'000},
+        UnitSuffix{"s", 1, 1},
+        UnitSuffix{"m", 60, 1},
+        UnitSuffix{"min", 60, 1},
+        UnitSuffix{"h", 3'600, 1},
+        UnitSuffix{"d", 86'400, 1},
+        UnitSuffix{"w", 604'800, 1},
+    };
+
+    // Base unit: one byte. Single letters are SI multiples, like the SI
+    // symbols they stand for, and binary multiples need the "i".
+    inline constexpr std::array byte_size_suffixes{
+        UnitSuffix{"B", 1, 1},
+        UnitSuffix{"k", 1'000, 1},
+        UnitSuffix{"kB", 1'000, 1},
+        UnitSuffix{"K", 1'000, 1},
+        UnitSuffix{"KB", 1'000, 1},
+        UnitSuffix{"M", 1'000'000, 1},
+        UnitSuffix{"MB", 1'000'000, 1},
+        UnitSuffix{"G", 1'000'000'000, 1},
+        UnitSuffix{"GB", 1'000'000'000, 1},
+        UnitSuffix{"T", 1'000'000'000'000, 1},
+        UnitSuffix{"TB", 1'000'000'000'000, 1},
+        UnitSuffix{"P", 1'000'000'000'000'000, 1},
+        UnitSuffix{"PB", 1'000'000'000'000'000, 1},
+        UnitSuffix{"E", 1'000'000'000'000'000'000, 1},
+        UnitSuffix{"EB", 1'000'000'000'000'000'000, 1},
+        UnitSuffix{"Ki", std::uint64_t{1} << 10, 1},
+        UnitSuffix{"KiB", std::uint64_t{1} << 10, 1},
+        UnitSuffix{"Mi", std::uint64_t{1} << 20, 1},
+        UnitSuffix{"MiB", std::uint64_t{1} << 20, 1},
+        UnitSuffix{"Gi", std::uint64_t{1} << 30, 1},
+        UnitSuffix{"GiB", std::uint64_t{1} << 30, 1},
+        UnitSuffix{"Ti", std::uint64_t{1} << 40, 1},
+        UnitSuffix{"TiB", std::uint64_t{1} << 40, 1},
+        UnitSuffix{"Pi", std::uint64_t{1} << 50, 1},
+        UnitSuffix{"PiB", std::uint64_t{1} << 50, 1},
+        UnitSuffix{"Ei", std::uint64_t{1} << 60, 1},
+        UnitSuffix{"EiB", std::uint64_t{1} << 60, 1},
+    };
+
+    // Base unit: one event
+    inline constexpr std::array count_suffixes{
+        UnitSuffix{"k", 1'000, 1},
+        UnitSuffix{"K", 1'000, 1},
+        UnitSuffix{"M", 1'000'000, 1},
+        UnitSuffix{"G", 1'000'000'000, 1},
+        UnitSuffix{"T", 1'000'000'000'000, 1},
+    };
+
+    [[nodiscard]] constexpr const UnitSuffix *find_unit_suffix(std::span<const UnitSuffix> units, std::string_view suffix) noexcept;
+
+    // Unit suffixes are letters, or the bytes of a UTF-8 sequence like "µ"
+    [[nodiscard]] constexpr bool is_unit_character(char c) noexcept;
+
+    // Return false instead of overflowing
+    [[nodiscard]] constexpr bool checked_add(std::uint64_t a, std::uint64_t b, std::uint64_t &result) noexcept;
+    [[nodiscard]] constexpr bool checked_multiply(std::uint64_t a, std::uint64_t b, std::uint64_t &result) noexcept;
+
+    // The factor converting a count of from into a count of to, reduced to
+    // lowest terms. Returns false if the factor does not fit.
+    [[nodiscard]] constexpr bool unit_conversion_factor(const UnitSuffix &from, const UnitSuffix &to, UnitSuffix &factor) noexcept;
+
+    // An amount of memory, parsed from values like "4096", "64MiB" or "2G"
+    struct ByteSize
+    {
+        std::uint64_t bytes{0};
+
+        constexpr auto operator<=>(const ByteSize &) const = default;
+    };
+
+    // count events per period, parsed from values like "10k/s", "500/min"
+    // or "20/100ms"
+    struct Rate
+    {
+        std::uint64_t count{0};
+        std::uint64_t period_nanoseconds{1'000'000'000};
+
+        [[nodiscard]] constexpr std::chrono::nanoseconds period() const noexcept;
+        [[nodiscard]] constexpr double                   per_second() const noexcept;
+
+        constexpr bool operator==(const Rate &) const = default;
+    };
+} // namespace CLArgs
+
+constexpr const CLArgs::UnitSuffix *
+CLArgs::find_unit_suffix(const std::span<const UnitSuffix> units, const std::string_view suffix) noexcept
+{
+    for (const UnitSuffix &unit : units)
+    {
+        if (unit.suffix == suffix)
+        {
+            return &unit;
+        }
+    }
+    return nullptr;
+}
+
+constexpr bool
+CLArgs::is_unit_character(const char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || static_cast<unsigned char>(c) >= 0x80;
+}
+
+constexpr bool
+CLArgs::checked_add(const std::uint64_t a, const std::uint64_t b, std::uint64_t &result) noexcept
+{
+    if (b > std::numeric_limits<std::uint64_t>::max() - a)
+    {
+        return false;
+    }
+    result = a + b;
+    return true;
+}
+
+constexpr bool
+CLArgs::checked_multiply(const std::uint64_t a, const std::uint64_t b, std::uint64_t &result) noexcept
+{
+    if (a != 0 && b > std::numeric_limits<std::uint64_t>::max() / a)
+    {
+        return false;
+    }
+    result = a * b;
+    return true;
+}
+
+constexpr bool
+CLArgs::unit_conversion_factor(const UnitSuffix &from, const UnitSuffix &to, UnitSuffix &factor) noexcept
+{
+    // from.numerator / from.denominator * to.denominator / to.numerator,
+    // cancelled crosswise first so standard ratios never overflow
+    const std::uint64_t numerator_gcd   = std::gcd(from.numerator, to.numerator);
+    const std::uint64_t denominator_gcd = std::gcd(from.denominator, to.denominator);
+
+    if (!checked_multiply(from.numerator / numerator_gcd, to.denominator / denominator_gcd, factor.numerator) ||
+        !checked_multiply(from.denominator / denominator_gcd, to.numerator / numerator_gcd, factor.denominator))
+    {
+        return false;
+    }
+
+    const std::uint64_t gcd = std::gcd(factor.numerator, factor.denominator);
+    factor.numerator /= gcd;
+    factor.denominator /= gcd;
+    return true;
+}
+
+constexpr std::chrono::nanoseconds
+CLArgs::Rate::period() const noexcept
+{
+    return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(period_nanoseconds)};
+}
+
+constexpr double
+CLArgs::Rate::per_second() const noexcept
+{
+    return static_cast<double>(count) * 1e9 / static_cast<double>(period_nanoseconds);
+}
+
+#endif // CLARGS_QUANTITY_HPP
@@ -0,0 +1,219 @@
+#ifndef CLARGS_RELOADABLE_HPP
+#define CLARGS_RELOADABLE_HPP
+
+#include <CLArgs/command_line.hpp>
+#include <CLArgs/core.hpp>
+#include <CLArgs/parsed_args.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CLArgs
+{
+    // Holds the current ParsedArgs of a long-running program and replaces it
+    // on reload() without blocking readers.
+    //
+    // Every reload parses into a fresh parser, and only a snapshot that parsed
+    // and validated successfully is published; on error the previous snapshot
+    // stays current. Old snapshots are reference counted, so they are reclaimed
+    // once the last reader lets go of them.
+    //
+    // std::string_view values of a snapshot refer into the arguments or the
+    // command-line buffer of the parser, so a published snapshot shares its
+    // reference count with that parser and a copy of the arguments.
+    template <typename ParserType>
+    class Reloadable
+    {
+    public:
+        using Snapshot = std::remove_cvref_t<decltype(std::declval<ParserType &&>().snapshot())>;
+
+        class Reader;
+
+        Reloadable();
+        explicit Reloadable(Snapshot initial);
+
+        Reloadable(const Reloadable &) = delete;
+        Reloadable(Reloadable &&)      = delete;
+
+        Reloadable &operator=(const Reloadable &) = delete;
+        Reloadable &operator=(Reloadable &&)      = delete;
+
+        template <ArgumentRange Args>
+        void reload(std::string_view program, Args &&args);
+
+        template <ArgumentRange Args, std::invocable<const Snapshot &> Validator>
+        void reload(std::string_view program, Args &&args, Validator &&validate);
+
+        void reload_command_line(std::string_view program, std::string_view command_line);
+
+        template <std::invocable<const Snapshot &> Validator>
+        void reload_command_line(std::string_view program, std::string_view command_line, Validator &&validate);
+
+        [[nodiscard]] std::shared_ptr<const Snapshot> load() const;
+        [[nodiscard]] std::uint64_t                   version() const noexcept;
+        [[nodiscard]] Reader                          reader() const;
+
+    private:
+        // A published snapshot together with the storage its values refer into
+        struct Published
+        {
+            std::vector<std::string> arguments;
+            ParserType               parser;
+            std::optional<Snapshot>  snapshot;
+        };
+
+        template <typename Parse, typename Validator>
+        void parse_and_publish(Parse &&parse, Validator &&validate);
+
+        std::atomic<std::shared_ptr<const Snapshot>> snapshot_;
+        std::atomic<std::uint64_t>                   version_{0};
+        std::mutex                                   reload_mutex_;
+    };
+
+    // Per-thread view of a Reloadable. As long as no reload happened since the
+    // last call, get() costs a single acquire load of the version counter and
+    // never touches the shared reference count.
+    template <typename ParserType>
+    class Reloadable<ParserType>::Reader
+    {
+    public:
+        explicit Reader(const Reloadable &source);
+
+        [[nodiscard]] const Snapshot &get();
+
+    private:
+        const Reloadable               *source_;
+        std::uint64_t                   version_;
+        std::shared_ptr<const Snapshot> snapshot_;
+    };
+} // namespace CLArgs
+
+template <typename ParserType>
+CLArgs::Reloadable<ParserType>::Reloadable()
+    : Reloadable(ParserType{}.snapshot())
+{
+}
+
+template <typename ParserType>
+CLArgs::Reloadable<ParserType>::Reloadable(Snapshot initial)
+    : snapshot_{std::make_shared<const Snapshot>(std::move(initial))}
+{
+}
+
+template <typename ParserType>
+template <CLArgs::ArgumentRange Args>
+void
+CLArgs::Reloadable<ParserType>::reload(const std::string_view program, Args &&args)
+{
+    reload(program, std::forward<Args>(args), [](const Snapshot &) {});
+}
+
+template <typename ParserType>
+template <CLArgs::ArgumentRange Args, std::invocable<const typename CLArgs::Reloadable<ParserType>::Snapshot &> Validator>
+void
+CLArgs::Reloadable<ParserType>::reload(const std::string_view program, Args &&args, Validator &&validate)
+{
+    parse_and_publish(
+        [program, &args](Published &published)
+        {
+            for (const std::string_view arg : args)
+            {
+                published.arguments.emplace_back(arg);
+            }
+            published.parser.parse(program, published.arguments);
+        },
+        std::forward<Validator>(validate));
+}
+
+template <typename ParserType>
+void
+CLArgs::Reloadable<ParserType>::reload_command_line(const std::string_view program, const std::string_view command_line)
+{
+    reload_command_line(program, command_line, [](const Snapshot &) {});
+}
+
+template <typename ParserType>
+template <std::invocable<const typename CLArgs::Reloadable<ParserType>::Snapshot &> Validator>
+void
+CLArgs::Reloadable<ParserType>::reload_command_line(const std::string_view program,
+                                                    const std::string_view command_line,
+                                                    Validator            &&validate)
+{
+    parse_and_publish([program, command_line](Published &published) { published.parser.parse_command_line(program, command_line); },
+                      std::forward<Validator>(validate));
+}
+
+template <typename ParserType>
+std::shared_ptr<const typename CLArgs::Reloadable<ParserType>::Snapshot>
+CLArgs::Reloadable<ParserType>::load() const
+{
+    return snapshot_.load(std::memory_order_acquire);
+}
+
+template <typename ParserType>
+std::uint64_t
+CLArgs::Reloadable<ParserType>::version() const noexcept
+{
+    return version_.load(std::memory_order_acquire);
+}
+
+template <typename ParserType>
+typename CLArgs::Reloadable<ParserType>::Reader
+CLArgs::Reloadable<ParserType>::reader() const
+{
+    return Reader{*this};
+}
+
+template <typename ParserType>
+template <typename Parse, typename Validator>
+void
+CLArgs::Reloadable<ParserType>::parse_and_publish(Parse &&parse, Validator &&validate)
+{
+    // Parsed in place, so the parser is never moved away from the values
+    // that refer into it
+    auto published = std::make_shared<Published>();
+    std::invoke(std::forward<Parse>(parse), *published);
+
+    const Snapshot &snapshot = published->snapshot.emplace(std::move(published->parser).snapshot());
+    std::invoke(std::forward<Validator>(validate), snapshot);
+
+    std::shared_ptr<const Snapshot> next{std::move(published), &snapshot};
+
+    // The snapshot is stored before the version is bumped, so a reader that
+    // observes the new version is guaranteed to load this snapshot or a newer one
+    const std::scoped_lock lock{reload_mutex_};
+    snapshot_.store(std::move(next), std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_release);
+}
+
+template <typename ParserType>
+CLArgs::Reloadable<ParserType>::Reader::Reader(const Reloadable &source)
+    : source_{&source}
+    , version_{source.version()}
+    , snapshot_{source.load()}
+{
+}
+
+template <typename ParserType>
+const typename CLArgs::Reloadable<ParserType>::Snapshot &
+CLArgs::Reloadable<ParserType>::Reader::get()
+{
+    if (const std::uint64_t current = source_->version(); current != version_)
+    {
+        snapshot_ = source_->load();
+        version_  = current;
+    }
+    return *snapshot_;
+}
+
+#endif // CLARGS_RELOADABLE_HPP
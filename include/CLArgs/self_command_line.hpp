@@ -0,0 +1,120 @@
+#ifndef CLARGS_SELF_COMMAND_LINE_HPP
+#define CLARGS_SELF_COMMAND_LINE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CLArgs
+{
+    inline constexpr std::string_view default_proc_cmdline{"/proc/self/cmdline"};
+
+    // The arguments in a NUL-separated command line, like the contents of
+    // /proc/<pid>/cmdline, as views into contents. A trailing NUL does not
+    // start another argument.
+    [[nodiscard]] inline std::vector<std::string_view> split_nul_separated(std::string_view contents);
+
+    // The whole file at path in a single buffer. Files in /proc report a size
+    // of zero, so the buffer grows while reading instead.
+    [[nodiscard]] inline std::string read_proc_file(const std::filesystem::path &path);
+
+    // The arguments of the NUL-separated command line in the file at path,
+    // like /proc/<pid>/cmdline. The file is read again on every call.
+    [[nodiscard]] inline std::vector<std::string> read_command_line(const std::filesystem::path &path);
+
+    // The command line of the process, program name first, for code that
+    // never sees the argv of main(), like libraries and LD_PRELOAD agents.
+    // /proc/self/cmdline is read and split on the first call only, into
+    // storage that lives until the process exits, so later calls return the
+    // same span without any work.
+    [[nodiscard]] inline std::span<const std::string_view> self_command_line();
+} // namespace CLArgs
+
+inline std::vector<std::string_view>
+CLArgs::split_nul_separated(std::string_view contents)
+{
+    if (contents.ends_with('\0'))
+    {
+        contents.remove_suffix(1);
+    }
+
+    std::vector<std::string_view> arguments;
+    if (contents.empty())
+    {
+        return arguments;
+    }
+
+    arguments.reserve(static_cast<std::size_t>(std::ranges::count(contents, '\0')) + 1);
+    for (std::size_t start = 0;;)
+    {
+        const std::size_t end = contents.find('\0', start);
+        arguments.push_back(contents.substr(start, end - start));
+        if (end == std::string_view::npos)
+        {
+            break;
+        }
+        start = end + 1;
+    }
+    return arguments;
+}
+
+inline std::string
+CLArgs::read_proc_file(const std::filesystem::path &path)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        throw std::runtime_error("Unable to open " + path.string());
+    }
+
+    std::string contents(4096, '\0');
+    std::size_t size = 0;
+    while (file.read(contents.data() + size, static_cast<std::streamsize>(contents.size() - size)))
+    {
+        size = contents.size();
+        contents.resize(contents.size() * 2);
+    }
+    contents.resize(size + static_cast<std::size_t>(file.gcount()));
+
+    if (file.bad())
+    {
+        throw std::runtime_error("Unable to read " + path.string());
+    }
+    return contents;
+}
+
+inline std::vector<std::string>
+CLArgs::read_command_line(const std::filesystem::path &path)
+{
+    const std::string contents = read_proc_file(path);
+
+    std::vector<std::string> arguments;
+    for (const std::string_view argument : split_nul_separated(contents))
+    {
+        arguments.emplace_back(argument);
+    }
+    return arguments;
+}
+
+inline std::span<const std::string_view>
+CLArgs::self_command_line()
+{
+    struct SelfCommandLine
+    {
+        std::string                   contents{read_proc_file(default_proc_cmdline)};
+        std::vector<std::string_view> arguments{split_nul_separated(contents)};
+    };
+
+    // Initialized once even with concurrent callers. If reading fails, the
+    // exception propagates and the next call tries again.
+    static const SelfCommandLine self;
+    return self.arguments;
+}
+
+#endif // CLARGS_SELF_COMMAND_LINE_HPP
@@ -0,0 +1,193 @@
+#ifndef CLARGS_SUGGESTIONS_HPP
+#define CLARGS_SUGGESTIONS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace CLArgs
+{
+    inline constexpr std::size_t max_suggestion_distance{2};
+
+    // Optimal string alignment distance (Damerau-Levenshtein without repeated
+    // edits of a substring), computed with Hyyrö's bit-parallel algorithm in
+    // one pass over text. The pattern must not be longer than 64 characters.
+    [[nodiscard]] inline std::size_t damerau_distance(std::string_view pattern, std::string_view text) noexcept;
+
+    // Returns the identifier closest to arg, if it is at most max_distance
+    // edits away, otherwise an empty string_view. Identifiers whose length
+    // alone rules them out are skipped without computing their distance.
+    [[nodiscard]] inline std::string_view closest_identifier(std::span<const std::string_view> identifiers,
+                                                             std::string_view                  arg,
+                                                             std::size_t max_distance = max_suggestion_distance) noexcept;
+
+    // Thrown for arguments that match no flag or option. The suggestion is
+    // only searched for when the message is first requested, so rejecting
+    // unknown arguments costs nothing extra unless someone reads the error.
+    // The message is built once, even if what() is called from several
+    // threads, and identifiers must outlive every copy of the exception.
+    class UnknownOptionException final : public std::invalid_argument
+    {
+    public:
+        UnknownOptionException(std::string_view arg, std::span<const std::string_view> identifiers);
+
+        [[nodiscard]] const char *what() const noexcept override;
+
+        [[nodiscard]] std::string_view argument() const noexcept;
+
+    private:
+        // Shared, so the exception stays copyable
+        struct Message
+        {
+            std::once_flag built;
+            std::string    text;
+        };
+
+        [[nodiscard]] static std::string describe(std::string_view arg, std::span<const std::string_view> identifiers);
+
+        std::string                       arg_;
+        std::span<const std::string_view> identifiers_;
+        std::shared_ptr<Message>          message_;
+    };
+} // namespace CLArgs
+
+inline std::size_t
+CLArgs::damerau_distance(const std::string_view pattern, const std::string_view text) noexcept
+{
+    const std::size_t length = pattern.size();
+    if (length == 0)
+    {
+        return text.size();
+    }
+
+    std::array<std::uint64_t, std::numeric_limits<unsigned char>::max() + 1> match_masks{};
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        match_masks[static_cast<unsigned char>(pattern[i])] |= std::uint64_t{1} << i;
+    }
+
+    const std::uint64_t last_bit = std::uint64_t{1} << (length - 1);
+
+    std::uint64_t vertical_positive = ~std::uint64_t{0};
+    std::uint64_t vertical_negative = 0;
+    std::uint64_t diagonal_zero     = 0;
+    std::uint64_t previous_match    = 0;
+    std::size_t   distance          = length;
+
+    for (const char c : text)
+    {
+        const std::uint64_t match         = match_masks[static_cast<unsigned char>(c)];
+        const std::uint64_t transposition = ((~diagonal_zero & match) << 1) & previous_match;
+
+        diagonal_zero = (((match & vertical_positive) + vertical_positive) ^ vertical_positive) | match | vertical_negative | transposition;
+
+        std::uint64_t horizontal_positive = vertical_negative | ~(diagonal_zero | vertical_positive);
+        std::uint64_t horizontal_negative = diagonal_zero & vertical_positive;
+
+        if ((horizontal_positive & last_bit) != 0)
+        {
+            ++distance;
+        }
+        else if ((horizontal_negative & last_bit) != 0)
+        {
+            --distance;
+        }
+
+        horizontal_positive = (horizontal_positive << 1) | 1;
+        horizontal_negative = horizontal_negative << 1;
+
+        vertical_positive = horizontal_negative | ~(diagonal_zero | horizontal_positive);
+        vertical_negative = horizontal_positive & diagonal_zero;
+        previous_match    = match;
+    }
+
+    return distance;
+}
+
+inline std::string_view
+CLArgs::closest_identifier(const std::span<const std::string_view> identifiers,
+                           const std::string_view                  arg,
+                           const std::size_t                       max_distance) noexcept
+{
+    if (arg.empty() || arg.size() > 64)
+    {
+        return {};
+    }
+
+    std::string_view closest;
+    std::size_t      closest_distance = max_distance + 1;
+
+    for (const std::string_view identifier : identifiers)
+    {
+        // The distance is at least the difference in length
+        const std::size_t length_difference = std::max(identifier.size(), arg.size()) - std::min(identifier.size(), arg.size());
+        if (length_difference >= closest_distance)
+        {
+            continue;
+        }
+
+        if (const std::size_t distance = damerau_distance(arg, identifier); distance < closest_distance)
+        {
+            closest          = identifier;
+            closest_distance = distance;
+        }
+    }
+
+    return closest;
+}
+
+inline CLArgs::UnknownOptionException::UnknownOptionException(const std::string_view                  arg,
+                                                              const std::span<const std::string_view> identifiers)
+    : std::invalid_argument("Unknown option")
+    , arg_{arg}
+    , identifiers_{identifiers}
+    , message_{std::make_shared<Message>()}
+{
+}
+
+inline const char *
+CLArgs::UnknownOptionException::what() const noexcept
+{
+    try
+    {
+        // If describe() throws, the flag stays unset and the next call tries again
+        std::call_once(message_->built, [this] { message_->text = describe(arg_, identifiers_); });
+        return message_->text.c_str();
+    }
+    catch (...)
+    {
+        return std::invalid_argument::what();
+    }
+}
+
+inline std::string
+CLArgs::UnknownOptionException::describe(const std::string_view arg, const std::span<const std::string_view> identifiers)
+{
+    std::string description{"Unknown option \""};
+    description += arg;
+    description += '"';
+
+    if (const std::string_view suggestion = closest_identifier(identifiers, arg); !suggestion.empty())
+    {
+        description += ", did you mean \"";
+        description += suggestion;
+        description += "\"?";
+    }
+    return description;
+}
+
+inline std::string_view
+CLArgs::UnknownOptionException::argument() const noexcept
+{
+    return arg_;
+}
+
+#endif // CLARGS_SUGGESTIONS_HPP
@@ -0,0 +1,292 @@
+#ifndef CLARGS_THREAD_COUNT_HPP
+#define CLARGS_THREAD_COUNT_HPP
+
+#include <CLArgs/cpu_set.hpp>
+#include <CLArgs/value_traits.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+namespace CLArgs
+{
+    // A number of threads, parsed from "8", "auto" or a multiple of the
+    // usable CPUs like "0.5x". Relative counts are resolved when they are
+    // needed, not while parsing.
+    struct ThreadCount
+    {
+        std::uint32_t count{0};            // 0 for a count relative to the usable CPUs
+        double        cpu_multiplier{1.0}; // Only used by relative counts
+
+        [[nodiscard]] constexpr bool is_relative() const noexcept;
+
+        // The count for usable_cpus usable CPUs, at least one
+        [[nodiscard]] constexpr std::uint32_t resolve(std::uint32_t usable_cpus) const noexcept;
+        [[nodiscard]] std::uint32_t           resolve() const;
+
+        constexpr bool operator==(const ThreadCount &) const = default;
+    };
+
+    inline constexpr std::string_view default_cgroup_root{"/sys/fs/cgroup"};
+    inline constexpr std::string_view default_proc_cgroup{"/proc/self/cgroup"};
+
+    // The number of CPUs the process may run on: its affinity mask, further
+    // limited by the cgroup v2 CPU quota. The paths only change for tests.
+    [[nodiscard]] inline std::uint32_t usable_cpu_count(const std::filesystem::path &cgroup_root = default_cgroup_root,
+                                                        const std::filesystem::path &proc_cgroup = default_proc_cgroup);
+
+    // CPUs in the affinity mask of the process, or hardware_concurrency()
+    // where there is no affinity mask
+    [[nodiscard]] inline std::uint32_t affinity_cpu_count() noexcept;
+
+    // The smallest quota in CPUs set by the cpu.max files of the cgroup at
+    // path cgroup below cgroup_root and all of its ancestors, or nothing if
+    // none of them limit the CPU time
+    [[nodiscard]] inline std::optional<double> cgroup_cpu_quota(const std::filesystem::path &cgroup_root, std::string_view cgroup);
+
+    // The cgroup v2 path in the contents of /proc/<pid>/cgroup, from the
+    // line like "0::/system.slice/app.service"
+    [[nodiscard]] constexpr std::optional<std::string_view> cgroup_v2_path(std::string_view proc_cgroup) noexcept;
+
+    // Quota divided by period, from the contents of a cpu.max file like
+    // "150000 100000". Nothing for "max", or if the contents are malformed.
+    [[nodiscard]] inline std::optional<double> parse_cpu_max(std::string_view cpu_max) noexcept;
+
+    [[nodiscard]] inline std::optional<std::string> read_file_contents(const std::filesystem::path &path);
+
+    template <>
+    struct ValueTraits<ThreadCount>
+    {
+        static constexpr std::string_view name{"thread count"};
+
+        static ValueParseResult parse(std::string_view sv, ThreadCount &out) noexcept;
+    };
+} // namespace CLArgs
+
+constexpr bool
+CLArgs::ThreadCount::is_relative() const noexcept
+{
+    return count == 0;
+}
+
+constexpr std::uint32_t
+CLArgs::ThreadCount::resolve(const std::uint32_t usable_cpus) const noexcept
+{
+    if (!is_relative())
+    {
+        return count;
+    }
+
+    constexpr std::uint32_t max_count = std::numeric_limits<std::uint32_t>::max();
+
+    const double threads = cpu_multiplier * static_cast<double>(usable_cpus);
+    if (threads < 1.0)
+    {
+        return 1;
+    }
+    return threads >= static_cast<double>(max_count) ? max_count : static_cast<std::uint32_t>(threads);
+}
+
+inline std::uint32_t
+CLArgs::ThreadCount::resolve() const
+{
+    return is_relative() ? resolve(usable_cpu_count()) : count;
+}
+
+inline std::uint32_t
+CLArgs::usable_cpu_count(const std::filesystem::path &cgroup_root, const std::filesystem::path &proc_cgroup)
+{
+    std::uint32_t cpus = affinity_cpu_count();
+
+    const std::optional<std::string> proc_cgroup_contents = read_file_contents(proc_cgroup);
+    if (!proc_cgroup_contents)
+    {
+        return cpus;
+    }
+
+    const std::optional<std::string_view> cgroup = cgroup_v2_path(*proc_cgroup_contents);
+    if (!cgroup)
+    {
+        return cpus;
+    }
+
+    // A quota of 1.5 CPUs still lets two threads make progress at once
+    if (const std::optional<double> quota = cgroup_cpu_quota(cgroup_root, *cgroup); quota && std::ceil(*quota) < cpus)
+    {
+        cpus = std::max(static_cast<std::uint32_t>(std::ceil(*quota)), std::uint32_t{1});
+    }
+    return cpus;
+}
+
+inline std::uint32_t
+CLArgs::affinity_cpu_count() noexcept
+{
+    if (const std::optional<CpuSet> set = affinity_cpu_set(); set && !set->empty())
+    {
+        return static_cast<std::uint32_t>(set->count());
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+inline std::optional<double>
+CLArgs::cgroup_cpu_quota(const std::filesystem::path &cgroup_root, std::string_view cgroup)
+{
+    std::optional<double> smallest;
+
+    // A cgroup outside of the cgroup namespace shows up as "/../..", only
+    // the limits visible at the root of the namespace can be read then
+    if (cgroup.find("..") != std::string_view::npos)
+    {
+        cgroup = {};
+    }
+
+    // Limits of all ancestors apply, so walk up to the root of the hierarchy
+    while (true)
+    {
+        while (cgroup.starts_with('/'))
+        {
+            cgroup.remove_prefix(1);
+        }
+
+        if (const std::optional<std::string> cpu_max = read_file_contents(cgroup_root / cgroup / "cpu.max"))
+        {
+            if (const std::optional<double> quota = parse_cpu_max(*cpu_max); quota && (!smallest || *quota < *smallest))
+            {
+                smallest = quota;
+            }
+        }
+
+        if (cgroup.empty())
+        {
+            return smallest;
+        }
+
+        const std::size_t parent_end = cgroup.rfind('/');
+        cgroup                       = parent_end == std::string_view::npos ? std::string_view{} : cgroup.substr(0, parent_end);
+    }
+}
+
+constexpr std::optional<std::string_view>
+CLArgs::cgroup_v2_path(std::string_view proc_cgroup) noexcept
+{
+    // Lines are "hierarchy-ID:controller-list:cgroup-path", cgroup v2 is the
+    // one with ID 0 and no controllers
+    while (!proc_cgroup.empty())
+    {
+        const std::size_t      line_end = proc_cgroup.find('\n');
+        const std::string_view line     = proc_cgroup.substr(0, line_end);
+
+        if (line.starts_with("0::"))
+        {
+            return line.substr(3);
+        }
+
+        proc_cgroup = line_end == std::string_view::npos ? std::string_view{} : proc_cgroup.substr(line_end + 1);
+    }
+    return std::nullopt;
+}
+
+inline std::optional<double>
+CLArgs::parse_cpu_max(std::string_view cpu_max) noexcept
+{
+    while (!cpu_max.empty() && (cpu_max.back() == '\n' || cpu_max.back() == ' '))
+    {
+        cpu_max.remove_suffix(1);
+    }
+
+    const std::size_t separator = cpu_max.find(' ');
+    if (separator == std::string_view::npos)
+    {
+        return std::nullopt;
+    }
+
+    const std::string_view quota_sv  = cpu_max.substr(0, separator);
+    const std::string_view period_sv = cpu_max.substr(separator + 1);
+    if (quota_sv == "max")
+    {
+        return std::nullopt;
+    }
+
+    std::uint64_t quota{};
+    std::uint64_t period{};
+    const auto [quota_end, quota_ec]   = std::from_chars(quota_sv.data(), quota_sv.data() + quota_sv.size(), quota);
+    const auto [period_end, period_ec] = std::from_chars(period_sv.data(), period_sv.data() + period_sv.size(), period);
+    if (quota_ec != std::errc{} || quota_end != quota_sv.data() + quota_sv.size() || period_ec != std::errc{} ||
+        period_end != period_sv.data() + period_sv.size() || period == 0)
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<double>(quota) / static_cast<double>(period);
+}
+
+inline std::optional<std::string>
+CLArgs::read_file_contents(const std::filesystem::path &path)
+{
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+inline CLArgs::ValueParseResult
+CLArgs::ValueTraits<CLArgs::ThreadCount>::parse(const std::string_view sv, ThreadCount &out) noexcept
+{
+    if (sv == "auto")
+    {
+        out = ThreadCount{};
+        return {};
+    }
+
+    const char *first = sv.data();
+    const char *last  = sv.data() + sv.size();
+
+    if (sv.ends_with('x'))
+    {
+        double multiplier{};
+        const auto [end, ec] = std::from_chars(first, last - 1, multiplier);
+        if (ec != std::errc{} || end != last - 1)
+        {
+            return {ParseStatus::InvalidFormat, static_cast<std::size_t>(end - first), "Expected a multiple of the CPUs, like 0.5x"};
+        }
+        if (!std::isfinite(multiplier) || multiplier <= 0.0)
+        {
+            return {ParseStatus::OutOfRange, 0, "Multiple of the CPUs must be positive"};
+        }
+
+        out = ThreadCount{0, multiplier};
+        return {};
+    }
+
+    std::uint32_t count{};
+    const auto [end, ec] = std::from_chars(first, last, count);
+    if (ec == std::errc::result_out_of_range)
+    {
+        return {ParseStatus::OutOfRange, 0, {}};
+    }
+    if (ec != std::errc{} || end != last)
+    {
+        return {ParseStatus::InvalidFormat, static_cast<std::size_t>(end - first), "Expected a number, \"auto\" or a multiple like 0.5x"};
+    }
+    if (count == 0)
+    {
+        return {ParseStatus::OutOfRange, 0, "Thread count must be at least 1"};
+    }
+
+    out = ThreadCount{count, 1.0};
+    return {};
+}
+
+#endif // CLARGS_THREAD_COUNT_HPP
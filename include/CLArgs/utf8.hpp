@@ -0,0 +1,198 @@
+#ifndef CLARGS_UTF8_HPP
+#define CLARGS_UTF8_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+namespace CLArgs
+{
+    template <typename T>
+    concept Utf8StringValue = std::is_same_v<T, std::string> || std::is_same_v<T, std::pmr::string> ||
+                              std::is_same_v<T, std::string_view> || std::is_same_v<T, std::filesystem::path>;
+
+    // Value types that are checked when UTF-8 validation is enabled: strings,
+    // paths, and lists of them
+    template <typename T>
+    concept Utf8ValidatedValue = Utf8StringValue<T> || (requires { typename T::value_type; } && Utf8StringValue<typename T::value_type>);
+
+    // Returns the offset of the first byte that does not start a well-formed
+    // UTF-8 sequence, as defined by table 3-7 of the Unicode standard, or
+    // sv.size() if all of sv is valid. Overlong forms, surrogates and code
+    // points above U+10FFFF are rejected.
+    [[nodiscard]] inline std::size_t find_invalid_utf8(std::string_view sv) noexcept;
+
+    [[nodiscard]] inline bool is_valid_utf8(std::string_view sv) noexcept;
+
+    // Validates one byte at a time. Used for the non-ASCII parts of a string,
+    // and kept public as the reference find_invalid_utf8() is tested against.
+    [[nodiscard]] inline std::size_t find_invalid_utf8_scalar(std::string_view sv) noexcept;
+
+    // Length of the longest prefix of data that only holds ASCII, checked a
+    // vector register at a time. May stop up to one block early.
+    [[nodiscard]] inline std::size_t ascii_prefix_length(const char *data, std::size_t size) noexcept;
+
+    // Length of the well-formed sequence starting at data[0], or 0
+    [[nodiscard]] inline std::size_t utf8_sequence_length(const unsigned char *data, std::size_t size) noexcept;
+} // namespace CLArgs
+
+inline std::size_t
+CLArgs::find_invalid_utf8(const std::string_view sv) noexcept
+{
+    // Non-ASCII text is validated a block at a time before switching back to
+    // the vectorized scan, so mixed text does not pay for a vector load per
+    // character
+    constexpr std::size_t scalar_block_size{64};
+
+    const auto       *data = reinterpret_cast<const unsigned char *>(sv.data());
+    const std::size_t size = sv.size();
+
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        offset += ascii_prefix_length(sv.data() + offset, size - offset);
+
+        const std::size_t scalar_end = offset + scalar_block_size < size ? offset + scalar_block_size : size;
+        while (offset < scalar_end)
+        {
+            const std::size_t length = utf8_sequence_length(data + offset, size - offset);
+            if (length == 0)
+            {
+                return offset;
+            }
+            offset += length;
+        }
+    }
+
+    return size;
+}
+
+inline bool
+CLArgs::is_valid_utf8(const std::string_view sv) noexcept
+{
+    return find_invalid_utf8(sv) == sv.size();
+}
+
+inline std::size_t
+CLArgs::find_invalid_utf8_scalar(const std::string_view sv) noexcept
+{
+    const auto       *data = reinterpret_cast<const unsigned char *>(sv.data());
+    const std::size_t size = sv.size();
+
+    std::size_t offset = 0;
+    while (offset < size)
+    {
+        const std::size_t length = utf8_sequence_length(data + offset, size - offset);
+        if (length == 0)
+        {
+            return offset;
+        }
+        offset += length;
+    }
+
+    return size;
+}
+
+inline std::size_t
+CLArgs::ascii_prefix_length(const char *data, const std::size_t size) noexcept
+{
+    std::size_t offset = 0;
+
+#if defined(__AVX2__)
+    for (; offset + 32 <= size; offset += 32)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+        if (_mm256_movemask_epi8(block) != 0)
+        {
+            return offset;
+        }
+    }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    for (; offset + 16 <= size; offset += 16)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+        if (_mm_movemask_epi8(block) != 0)
+        {
+            return offset;
+        }
+    }
+#endif
+
+    // Portable fallback, and the tail: eight bytes at a time in a register
+    for (; offset + 8 <= size; offset += 8)
+    {
+        std::uint64_t block{};
+        std::memcpy(&block, data + offset, sizeof(block));
+        if ((block & 0x8080808080808080) != 0)
+        {
+            return offset;
+        }
+    }
+
+    return offset;
+}
+
+inline std::size_t
+CLArgs::utf8_sequence_length(const unsigned char *data, const std::size_t size) noexcept
+{
+    const unsigned char lead = data[0];
+    if (lead < 0x80)
+    {
+        return 1;
+    }
+
+    // The allowed range of the second byte depends on the lead byte, all
+    // further bytes are plain continuation bytes
+    std::size_t   length{};
+    unsigned char second_min = 0x80;
+    unsigned char second_max = 0xBF;
+
+    if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        length = 2;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length     = 3;
+        second_min = lead == 0xE0 ? 0xA0 : 0x80;
+        second_max = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length     = 4;
+        second_min = lead == 0xF0 ? 0x90 : 0x80;
+        second_max = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+        return 0;
+    }
+
+    if (size < length || data[1] < second_min || data[1] > second_max)
+    {
+        return 0;
+    }
+
+    for (std::size_t i = 2; i < length; ++i)
+    {
+        if ((data[i] & 0xC0) != 0x80)
+        {
+            return 0;
+        }
+    }
+
+    return length;
+}
+
+#endif // CLARGS_UTF8_HPP
@@ -2,11 +2,20 @@
 #define CLARGS_VALUE_CONTAINER_HPP
 
 #include <CLArgs/core.hpp>
+#include <CLArgs/value_serialization.hpp>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <span>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace CLArgs
 {
@@ -19,22 +28,97 @@ namespace CLArgs
     {
     public:
         ValueContainer();
+        explicit ValueContainer(std::pmr::memory_resource *resource);
+        ~ValueContainer() = default;
+
+        // Like the std::pmr containers, a copy uses the default memory resource,
+        // and assignment never changes the resource of the target
+        ValueContainer(const ValueContainer &other);
+        ValueContainer(ValueContainer &&other) noexcept = default;
+
+        ValueContainer &operator=(const ValueContainer &other);
+        ValueContainer &operator=(ValueContainer &&other) noexcept(std::is_nothrow_move_assignable_v<ValuesTuple>);
 
         template <Parsable T>
         void set_value(const typename T::ValueType &value);
 
+        template <Parsable T>
+        void set_value(typename T::ValueType &&value);
+
+        // Constructs the value of T in place, using the container's resource,
+        // and returns it for the caller to fill in
+        template <Parsable T>
+        typename T::ValueType &emplace_value();
+
+        // Restores the value of T to its default, or to no value
+        template <Parsable T>
+        void reset_value();
+
+        // Records T as explicitly set and drops its stored value, for values
+        // that are written somewhere else
+        template <Parsable T>
+        void mark_set() noexcept;
+
+        // Whether T was recorded with mark_set(), so its value is not here
+        template <Parsable T>
+        [[nodiscard]] bool has_external_value() const noexcept;
+
+        [[nodiscard]] bool has_external_values() const noexcept;
+
         template <Parsable T>
         [[nodiscard]] const std::optional<typename T::ValueType> &get_value() const;
 
+        template <Parsable T>
+        [[nodiscard]] bool is_set() const noexcept;
+
         void reset();
 
+        [[nodiscard]] std::pmr::memory_resource *resource() const noexcept;
+
+        // Which values were explicitly set, one bit per Parsable in
+        // declaration order, and masks over the same bits for checking
+        // several Parsables at once
+        static constexpr std::size_t presence_words{(sizeof...(Parsables) + 63) / 64};
+        using PresenceBits = std::array<std::uint64_t, presence_words>;
+
+        [[nodiscard]] const PresenceBits &presence() const noexcept;
+
+        template <Parsable... Ts>
+        [[nodiscard]] static consteval PresenceBits presence_mask();
+
+        static constexpr std::uint64_t schema_hash{value_schema_hash<Parsables...>()};
+
+        [[nodiscard]] std::size_t                 serialized_size() const noexcept;
+        std::size_t                               serialize(std::span<std::byte> buffer) const;
+        [[nodiscard]] std::pmr::vector<std::byte> serialize() const;
+
+        void deserialize(std::span<const std::byte> blob);
+
     private:
         template <Parsable T>
         static consteval std::size_t index_of_type();
 
+        template <Parsable T>
+        std::optional<typename T::ValueType> initial_value() const;
+
+        template <Parsable T, typename V>
+        void store_value(V &&value);
+
+        [[nodiscard]] auto has_value_bits() const noexcept;
+
+        // Allocator-aware values, like std::pmr::string, are always constructed
+        // with this resource, so no value storage touches the global heap
+        std::pmr::memory_resource *resource_;
+
         using ValuesTuple = std::tuple<std::optional<typename Parsables::ValueType>...>;
         static_assert(all_unique_v<Parsables...>, "Duplicate template parameter types is not allowed in ValueContainer");
         ValuesTuple values_;
+
+        // Tracks which values were explicitly set, as values of options with a
+        // default are always present
+        static constexpr std::size_t bits_per_word_{64};
+
+        PresenceBits presence_{};
     };
 
     template <typename... Parsables>
@@ -48,18 +132,130 @@ namespace CLArgs
 
 template <CLArgs::Parsable... Parsables>
 CLArgs::ValueContainer<Parsables...>::ValueContainer()
-    : values_{std::make_tuple(std::optional<typename Parsables::ValueType>{}...)}
+    : ValueContainer(std::pmr::get_default_resource())
+{
+}
+
+template <CLArgs::Parsable... Parsables>
+CLArgs::ValueContainer<Parsables...>::ValueContainer(std::pmr::memory_resource *resource)
+    : resource_{resource}
+    , values_{initial_value<Parsables>()...}
+{
+}
+
+template <CLArgs::Parsable... Parsables>
+CLArgs::ValueContainer<Parsables...>::ValueContainer(const ValueContainer &other)
+    : resource_{std::pmr::get_default_resource()}
+    , values_{other.values_}
+    , presence_{other.presence_}
 {
 }
 
+template <CLArgs::Parsable... Parsables>
+CLArgs::ValueContainer<Parsables...> &
+CLArgs::ValueContainer<Parsables...>::operator=(const ValueContainer &other)
+{
+    if (this != &other)
+    {
+        values_   = other.values_;
+        presence_ = other.presence_;
+    }
+    return *this;
+}
+
+template <CLArgs::Parsable... Parsables>
+CLArgs::ValueContainer<Parsables...> &
+CLArgs::ValueContainer<Parsables...>::operator=(ValueContainer &&other) noexcept(std::is_nothrow_move_assignable_v<ValuesTuple>)
+{
+    values_   = std::move(other.values_);
+    presence_ = other.presence_;
+    return *this;
+}
+
 template <CLArgs::Parsable... Parsables>
 template <CLArgs::Parsable T>
 void
 CLArgs::ValueContainer<Parsables...>::set_value(const typename T::ValueType &value)
+{
+    store_value<T>(value);
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+void
+CLArgs::ValueContainer<Parsables...>::set_value(typename T::ValueType &&value)
+{
+    store_value<T>(std::move(value));
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T, typename V>
+void
+CLArgs::ValueContainer<Parsables...>::store_value(V &&value)
+{
+    constexpr std::size_t index = index_of_type<T>();
+    static_assert(std::is_same_v<std::tuple_element_t<index, ValuesTuple>, std::optional<typename T::ValueType>>);
+
+    const std::pmr::polymorphic_allocator<> allocator{resource_};
+    auto new_value = std::make_obj_using_allocator<typename T::ValueType>(allocator, std::forward<V>(value));
+
+    auto &slot = std::get<index>(values_);
+    slot.reset();
+    slot.emplace(std::move(new_value));
+    presence_[index / bits_per_word_] |= std::uint64_t{1} << (index % bits_per_word_);
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+typename T::ValueType &
+CLArgs::ValueContainer<Parsables...>::emplace_value()
 {
     constexpr std::size_t index = index_of_type<T>();
     static_assert(std::is_same_v<std::tuple_element_t<index, ValuesTuple>, std::optional<typename T::ValueType>>);
-    std::get<index>(values_) = std::optional<typename T::ValueType>{value};
+
+    const std::pmr::polymorphic_allocator<> allocator{resource_};
+
+    auto &slot = std::get<index>(values_);
+    slot.reset();
+    slot.emplace(std::make_obj_using_allocator<typename T::ValueType>(allocator));
+    presence_[index / bits_per_word_] |= std::uint64_t{1} << (index % bits_per_word_);
+    return *slot;
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+void
+CLArgs::ValueContainer<Parsables...>::reset_value()
+{
+    constexpr std::size_t index = index_of_type<T>();
+
+    std::get<index>(values_) = initial_value<T>();
+    presence_[index / bits_per_word_] &= ~(std::uint64_t{1} << (index % bits_per_word_));
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+void
+CLArgs::ValueContainer<Parsables...>::mark_set() noexcept
+{
+    constexpr std::size_t index = index_of_type<T>();
+    std::get<index>(values_).reset();
+    presence_[index / bits_per_word_] |= std::uint64_t{1} << (index % bits_per_word_);
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+bool
+CLArgs::ValueContainer<Parsables...>::has_external_value() const noexcept
+{
+    return is_set<T>() && !std::get<index_of_type<T>()>(values_).has_value();
+}
+
+template <CLArgs::Parsable... Parsables>
+bool
+CLArgs::ValueContainer<Parsables...>::has_external_values() const noexcept
+{
+    return (has_external_value<Parsables>() || ...);
 }
 
 template <CLArgs::Parsable... Parsables>
@@ -72,11 +268,167 @@ CLArgs::ValueContainer<Parsables...>::get_value() const
     return std::get<index>(values_);
 }
 
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+bool
+CLArgs::ValueContainer<Parsables...>::is_set() const noexcept
+{
+    constexpr std::size_t index = index_of_type<T>();
+    return (presence_[index / bits_per_word_] & (std::uint64_t{1} << (index % bits_per_word_))) != 0;
+}
+
 template <CLArgs::Parsable... Parsables>
 void
 CLArgs::ValueContainer<Parsables...>::reset()
 {
-    values_ = std::make_tuple(std::optional<typename Parsables::ValueType>{}...);
+    values_   = ValuesTuple{initial_value<Parsables>()...};
+    presence_ = {};
+}
+
+template <CLArgs::Parsable... Parsables>
+std::pmr::memory_resource *
+CLArgs::ValueContainer<Parsables...>::resource() const noexcept
+{
+    return resource_;
+}
+
+template <CLArgs::Parsable... Parsables>
+const typename CLArgs::ValueContainer<Parsables...>::PresenceBits &
+CLArgs::ValueContainer<Parsables...>::presence() const noexcept
+{
+    return presence_;
+}
+
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable... Ts>
+consteval typename CLArgs::ValueContainer<Parsables...>::PresenceBits
+CLArgs::ValueContainer<Parsables...>::presence_mask()
+{
+    PresenceBits mask{};
+    ((mask[index_of_type<Ts>() / bits_per_word_] |= std::uint64_t{1} << (index_of_type<Ts>() % bits_per_word_)), ...);
+    return mask;
+}
+
+template <CLArgs::Parsable... Parsables>
+std::size_t
+CLArgs::ValueContainer<Parsables...>::serialized_size() const noexcept
+{
+    static_assert((SerializableValue<typename Parsables::ValueType> && ...), "ValueContainer holds a value type that cannot be serialized");
+
+    std::size_t size = value_snapshot_header_size + 2 * sizeof(presence_);
+    std::apply([&size](const auto &...values) { ((size += values.has_value() ? serialized_value_size(*values) : 0), ...); }, values_);
+    return size;
+}
+
+template <CLArgs::Parsable... Parsables>
+std::size_t
+CLArgs::ValueContainer<Parsables...>::serialize(const std::span<std::byte> buffer) const
+{
+    if (has_external_values())
+    {
+        throw std::logic_error("Values held outside of the container cannot be serialized");
+    }
+
+    const std::size_t size = serialized_size();
+    if (buffer.size() < size)
+    {
+        throw std::invalid_argument("Buffer is too small for the value snapshot");
+    }
+
+    std::byte *out = buffer.data();
+    out            = write_serialized_integer<std::uint32_t>(out, value_snapshot_magic);
+    out            = write_serialized_integer<std::uint32_t>(out, value_snapshot_version);
+    out            = write_serialized_integer<std::uint64_t>(out, schema_hash);
+    out            = write_serialized_integer<std::uint64_t>(out, size - value_snapshot_header_size);
+
+    for (const std::uint64_t word : has_value_bits())
+    {
+        out = write_serialized_integer<std::uint64_t>(out, word);
+    }
+    for (const std::uint64_t word : presence_)
+    {
+        out = write_serialized_integer<std::uint64_t>(out, word);
+    }
+
+    std::apply([&out](const auto &...values) { ((out = values.has_value() ? write_serialized_value(out, *values) : out), ...); }, values_);
+    return size;
+}
+
+template <CLArgs::Parsable... Parsables>
+std::pmr::vector<std::byte>
+CLArgs::ValueContainer<Parsables...>::serialize() const
+{
+    std::pmr::vector<std::byte> blob(serialized_size(), resource_);
+    serialize(blob);
+    return blob;
+}
+
+template <CLArgs::Parsable... Parsables>
+void
+CLArgs::ValueContainer<Parsables...>::deserialize(std::span<const std::byte> blob)
+{
+    if (read_serialized_integer<std::uint32_t>(blob) != value_snapshot_magic)
+    {
+        throw std::invalid_argument("Not a value snapshot");
+    }
+    if (read_serialized_integer<std::uint32_t>(blob) != value_snapshot_version)
+    {
+        throw std::invalid_argument("Unsupported value snapshot version");
+    }
+    if (read_serialized_integer<std::uint64_t>(blob) != schema_hash)
+    {
+        throw std::invalid_argument("Value snapshot was created for different flags and options");
+    }
+    if (read_serialized_integer<std::uint64_t>(blob) != blob.size())
+    {
+        throw std::invalid_argument("Value snapshot has an unexpected size");
+    }
+
+    decltype(presence_) has_value{};
+    decltype(presence_) presence{};
+    for (std::uint64_t &word : has_value)
+    {
+        word = read_serialized_integer<std::uint64_t>(blob);
+    }
+    for (std::uint64_t &word : presence)
+    {
+        word = read_serialized_integer<std::uint64_t>(blob);
+    }
+
+    // Everything is read into a separate tuple first, so a corrupt snapshot
+    // leaves the current values untouched
+    ValuesTuple next;
+
+    const auto read_value = [&]<std::size_t Index>()
+    {
+        using T = typename std::tuple_element_t<Index, ValuesTuple>::value_type;
+        if ((has_value[Index / bits_per_word_] & (std::uint64_t{1} << (Index % bits_per_word_))) != 0)
+        {
+            std::get<Index>(next).emplace(read_serialized_value<T>(blob, resource_));
+        }
+    };
+    [&read_value]<std::size_t... Indices>(std::index_sequence<Indices...>) { (read_value.template operator()<Indices>(), ...); }(
+        std::index_sequence_for<Parsables...>{});
+
+    if (!blob.empty())
+    {
+        throw std::invalid_argument("Value snapshot has trailing bytes");
+    }
+
+    values_   = std::move(next);
+    presence_ = presence;
+}
+
+template <CLArgs::Parsable... Parsables>
+auto
+CLArgs::ValueContainer<Parsables...>::has_value_bits() const noexcept
+{
+    decltype(presence_) bits{};
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>)
+    {
+        ((bits[Indices / bits_per_word_] |= std::uint64_t{std::get<Indices>(values_).has_value()} << (Indices % bits_per_word_)), ...);
+    }(std::index_sequence_for<Parsables...>{});
+    return bits;
 }
 
 template <CLArgs::Parsable... Parsables>
@@ -87,4 +439,19 @@ CLArgs::ValueContainer<Parsables...>::index_of_type()
     return tuple_type_index_v<T, std::tuple<Parsables...>>;
 }
 
+template <CLArgs::Parsable... Parsables>
+template <CLArgs::Parsable T>
+std::optional<typename T::ValueType>
+CLArgs::ValueContainer<Parsables...>::initial_value() const
+{
+    if constexpr (CmdOptionWithDefault<T>)
+    {
+        return make_default_value<T>(std::pmr::polymorphic_allocator<>{resource_});
+    }
+    else
+    {
+        return std::nullopt;
+    }
+}
+
 #endif // CLARGS_VALUE_CONTAINER_HPP
@@ -0,0 +1,347 @@
+#ifndef CLARGS_VALUE_SERIALIZATION_HPP
+#define CLARGS_VALUE_SERIALIZATION_HPP
+
+#include <CLArgs/core.hpp>
+#include <CLArgs/cpu_set.hpp>
+#include <CLArgs/network.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/thread_count.hpp>
+
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace CLArgs
+{
+    // Layout of a serialized ValueContainer, all in native byte order:
+    //
+    //   header    magic, format version, schema hash, payload size
+    //   payload   has-value bits, presence bits, then every held value in
+    //             declaration order: scalars as their raw bytes, strings as a
+    //             64-bit length followed by the characters, lists element by
+    //             element, with a 64-bit size first for an InlineVector
+    //
+    // The schema hash covers identifiers, value types and byte order, so a blob
+    // is only accepted by a container with exactly the same Parsables.
+    inline constexpr std::uint32_t value_snapshot_magic{0x56414C43}; // "CLAV"
+    inline constexpr std::uint32_t value_snapshot_version{2};
+    inline constexpr std::size_t   value_snapshot_header_size{2 * sizeof(std::uint32_t) + 2 * sizeof(std::uint64_t)};
+
+    template <typename T>
+    concept SerializableStringValue = std::is_same_v<T, std::string> || std::is_same_v<T, std::pmr::string> ||
+                                      std::is_same_v<T, std::string_view> || std::is_same_v<T, std::filesystem::path>;
+
+    // Written as their raw bytes, so only types without pointers are allowed.
+    // Every bit pattern is a valid value, except for a bool, which is checked
+    // when it is read.
+    template <typename T>
+    concept SerializableScalarValue = std::is_arithmetic_v<T> || (StdChronoDuration<T> && std::is_arithmetic_v<typename T::rep>) ||
+                                      std::is_same_v<T, ByteSize> || std::is_same_v<T, Rate> || std::is_same_v<T, ThreadCount> ||
+                                      std::is_same_v<T, CpuSet> || NetworkValue<T>;
+
+    template <typename T>
+    concept SerializableElementValue = SerializableScalarValue<T> || SerializableStringValue<T>;
+
+    template <typename T>
+    concept SerializableValue =
+        SerializableElementValue<T> || ((StdArray<T> || InlineVectorType<T>) && SerializableElementValue<typename T::value_type>);
+
+    template <Parsable... Parsables>
+    [[nodiscard]] consteval std::uint64_t value_schema_hash();
+
+    // Mixes a tag for T into the FNV-1a hash, which tells apart types of the
+    // same layout, like std::int64_t and std::chrono::nanoseconds
+    template <SerializableValue T>
+    constexpr void mix_value_type_hash(std::uint64_t &hash);
+
+    constexpr void mix_schema_hash(std::uint64_t &hash, std::uint64_t value);
+
+    // The signature of this function, which names T. It is spelled
+    // differently by every compiler, and so are the schema hashes.
+    template <typename T>
+    [[nodiscard]] consteval std::string_view serialized_type_name();
+
+    template <SerializableValue T>
+    [[nodiscard]] std::size_t serialized_value_size(const T &value) noexcept;
+
+    template <SerializableValue T>
+    std::byte *write_serialized_value(std::byte *out, const T &value) noexcept;
+
+    // Values are read from the front of `in`, which is advanced past them.
+    // A std::string_view value refers into `in`, so the blob must outlive it.
+    template <SerializableValue T>
+    [[nodiscard]] T read_serialized_value(std::span<const std::byte> &in, std::pmr::memory_resource *resource);
+
+    template <std::unsigned_integral T>
+    std::byte *write_serialized_integer(std::byte *out, T value) noexcept;
+
+    template <std::unsigned_integral T>
+    [[nodiscard]] T read_serialized_integer(std::span<const std::byte> &in);
+} // namespace CLArgs
+
+template <CLArgs::Parsable... Parsables>
+consteval std::uint64_t
+CLArgs::value_schema_hash()
+{
+    // FNV-1a
+    std::uint64_t hash{0xcbf29ce484222325};
+
+    const auto mix_parsable = [&hash]<typename P>()
+    {
+        for (const std::string_view identifier : P::identifiers)
+        {
+            for (const char c : identifier)
+            {
+                mix_schema_hash(hash, static_cast<unsigned char>(c));
+            }
+            mix_schema_hash(hash, 0);
+        }
+
+        mix_value_type_hash<typename P::ValueType>(hash);
+    };
+
+    mix_schema_hash(hash, value_snapshot_version);
+    mix_schema_hash(hash, std::endian::native == std::endian::little);
+    (mix_parsable.template operator()<Parsables>(), ...);
+
+    return hash;
+}
+
+template <CLArgs::SerializableValue T>
+constexpr void
+CLArgs::mix_value_type_hash(std::uint64_t &hash)
+{
+    for (const char c : serialized_type_name<T>())
+    {
+        mix_schema_hash(hash, static_cast<unsigned char>(c));
+    }
+    mix_schema_hash(hash, 0);
+
+    mix_schema_hash(hash, sizeof(T));
+    mix_schema_hash(hash, alignof(T));
+    mix_schema_hash(hash, SerializableStringValue<T>);
+    mix_schema_hash(hash, std::is_integral_v<T>);
+    mix_schema_hash(hash, std::is_floating_point_v<T>);
+    mix_schema_hash(hash, std::is_signed_v<T>);
+
+    if constexpr (StdChronoDuration<T>)
+    {
+        mix_schema_hash(hash, static_cast<std::uint64_t>(T::period::num));
+        mix_schema_hash(hash, static_cast<std::uint64_t>(T::period::den));
+        mix_value_type_hash<typename T::rep>(hash);
+    }
+    else if constexpr (StdArray<T>)
+    {
+        mix_schema_hash(hash, std::tuple_size_v<T>);
+        mix_value_type_hash<typename T::value_type>(hash);
+    }
+    else if constexpr (InlineVectorType<T>)
+    {
+        mix_schema_hash(hash, T::capacity());
+        mix_value_type_hash<typename T::value_type>(hash);
+    }
+}
+
+constexpr void
+CLArgs::mix_schema_hash(std::uint64_t &hash, const std::uint64_t value)
+{
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+        hash ^= (value >> (i * 8)) & 0xff;
+        hash *= 0x100000001b3;
+    }
+}
+
+template <typename T>
+consteval std::string_view
+CLArgs::serialized_type_name()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+template <CLArgs::SerializableValue T>
+std::size_t
+CLArgs::serialized_value_size(const T &value) noexcept
+{
+    if constexpr (std::is_same_v<T, std::filesystem::path>)
+    {
+        return sizeof(std::uint64_t) + value.native().size() * sizeof(std::filesystem::path::value_type);
+    }
+    else if constexpr (SerializableStringValue<T>)
+    {
+        return sizeof(std::uint64_t) + value.size();
+    }
+    else if constexpr (StdArray<T> || InlineVectorType<T>)
+    {
+        std::size_t size{InlineVectorType<T> ? sizeof(std::uint64_t) : 0};
+        for (const auto &element : value)
+        {
+            size += serialized_value_size(element);
+        }
+        return size;
+    }
+    else
+    {
+        return sizeof(T);
+    }
+}
+
+template <CLArgs::SerializableValue T>
+std::byte *
+CLArgs::write_serialized_value(std::byte *out, const T &value) noexcept
+{
+    if constexpr (std::is_same_v<T, std::filesystem::path>)
+    {
+        const auto &native = value.native();
+        out                = write_serialized_integer<std::uint64_t>(out, native.size());
+        std::memcpy(out, native.data(), native.size() * sizeof(std::filesystem::path::value_type));
+        return out + native.size() * sizeof(std::filesystem::path::value_type);
+    }
+    else if constexpr (SerializableStringValue<T>)
+    {
+        out = write_serialized_integer<std::uint64_t>(out, value.size());
+        std::memcpy(out, value.data(), value.size());
+        return out + value.size();
+    }
+    else if constexpr (StdArray<T> || InlineVectorType<T>)
+    {
+        if constexpr (InlineVectorType<T>)
+        {
+            out = write_serialized_integer<std::uint64_t>(out, value.size());
+        }
+        for (const auto &element : value)
+        {
+            out = write_serialized_value(out, element);
+        }
+        return out;
+    }
+    else
+    {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <CLArgs::SerializableValue T>
+T
+CLArgs::read_serialized_value(std::span<const std::byte> &in, [[maybe_unused]] std::pmr::memory_resource *resource)
+{
+    const auto take = [&in](const std::size_t size)
+    {
+        if (in.size() < size)
+        {
+            throw std::invalid_argument("Value snapshot is truncated");
+        }
+        const std::span<const std::byte> bytes = in.first(size);
+        in                                     = in.subspan(size);
+        return bytes;
+    };
+
+    if constexpr (std::is_same_v<T, std::filesystem::path>)
+    {
+        using CharT = std::filesystem::path::value_type;
+
+        const auto                         length = read_serialized_integer<std::uint64_t>(in);
+        const auto                         bytes  = take(length * sizeof(CharT));
+        std::filesystem::path::string_type native(length, CharT{});
+        std::memcpy(native.data(), bytes.data(), bytes.size());
+        return std::filesystem::path{std::move(native)};
+    }
+    else if constexpr (SerializableStringValue<T>)
+    {
+        const auto             length = read_serialized_integer<std::uint64_t>(in);
+        const auto             bytes  = take(length);
+        const std::string_view chars{reinterpret_cast<const char *>(bytes.data()), bytes.size()};
+
+        if constexpr (std::is_same_v<T, std::pmr::string>)
+        {
+            return std::pmr::string{chars, resource};
+        }
+        else
+        {
+            return T{chars};
+        }
+    }
+    else if constexpr (StdArray<T>)
+    {
+        T value{};
+        for (auto &element : value)
+        {
+            element = read_serialized_value<typename T::value_type>(in, resource);
+        }
+        return value;
+    }
+    else if constexpr (InlineVectorType<T>)
+    {
+        const auto size = read_serialized_integer<std::uint64_t>(in);
+        if (size > T::capacity())
+        {
+            throw std::invalid_argument("Value snapshot holds a list larger than its capacity");
+        }
+
+        T value{};
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            value.push_back(read_serialized_value<typename T::value_type>(in, resource));
+        }
+        return value;
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        static_assert(sizeof(bool) == 1);
+
+        const auto byte = std::to_integer<unsigned char>(take(1).front());
+        if (byte > 1)
+        {
+            throw std::invalid_argument("Value snapshot holds an invalid bool");
+        }
+        return byte == 1;
+    }
+    else
+    {
+        const auto bytes = take(sizeof(T));
+        T          value{};
+        std::memcpy(&value, bytes.data(), sizeof(T));
+        return value;
+    }
+}
+
+template <std::unsigned_integral T>
+std::byte *
+CLArgs::write_serialized_integer(std::byte *out, const T value) noexcept
+{
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+template <std::unsigned_integral T>
+T
+CLArgs::read_serialized_integer(std::span<const std::byte> &in)
+{
+    if (in.size() < sizeof(T))
+    {
+        throw std::invalid_argument("Value snapshot is truncated");
+    }
+
+    T value{};
+    std::memcpy(&value, in.data(), sizeof(T));
+    in = in.subspan(sizeof(T));
+    return value;
+}
+
+#endif // CLARGS_VALUE_SERIALIZATION_HPP
@@ -0,0 +1,77 @@
+#ifndef CLARGS_VALUE_TRAITS_HPP
+#define CLARGS_VALUE_TRAITS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace CLArgs
+{
+    enum class ParseStatus : std::uint8_t
+    {
+        Ok,
+        InvalidFormat,
+        OutOfRange,
+    };
+
+    // Result of a parse that does not throw. On failure, error_offset is the
+    // position in the string the error was found at, and message, if not
+    // empty, must have static storage duration.
+    struct ValueParseResult
+    {
+        ParseStatus      status{ParseStatus::Ok};
+        std::size_t      error_offset{0};
+        std::string_view message{};
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept;
+    };
+
+    // Customization point for user-defined value types, as an alternative to
+    // specializing parse_value<T>(). A specialization provides
+    //
+    //     static ValueParseResult parse(std::string_view sv, T &out) noexcept;
+    //
+    // which parses into a default constructed out, and optionally
+    //
+    //     static constexpr std::string_view name{"shard spec"};
+    //
+    // which is used in error messages. The parser constructs the value in
+    // place in its ValueContainer and only throws once parse() has failed.
+    template <typename T>
+    struct ValueTraits;
+
+    template <typename T>
+    concept TraitsParsableValue = std::default_initializable<T> && requires(std::string_view sv, T &out) {
+        { ValueTraits<T>::parse(sv, out) } noexcept -> std::same_as<ValueParseResult>;
+    };
+
+    template <typename T>
+    concept NamedValueTraits = requires {
+        { ValueTraits<T>::name } -> std::convertible_to<std::string_view>;
+    };
+
+    // Like "Invalid format at offset 3", for ParseValueException
+    [[nodiscard]] inline std::string describe_parse_error(const ValueParseResult &result);
+} // namespace CLArgs
+
+constexpr CLArgs::ValueParseResult::operator bool() const noexcept
+{
+    return status == ParseStatus::Ok;
+}
+
+inline std::string
+CLArgs::describe_parse_error(const ValueParseResult &result)
+{
+    std::string description{result.message};
+    if (description.empty())
+    {
+        description = result.status == ParseStatus::OutOfRange ? "Number out of range" : "Invalid format";
+    }
+    description += " at offset ";
+    description += std::to_string(result.error_offset);
+    return description;
+}
+
+#endif // CLARGS_VALUE_TRAITS_HPP
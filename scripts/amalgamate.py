@@ -9,6 +9,8 @@ import sys
 
 CLARGS_INCLUDE_PATTERN = re.compile(r"#include <CLArgs/(\w+\.hpp)>")
 SYSTEM_INCLUDE_PATTERN = re.compile(r"#include <(.+?)>")
+CONDITIONAL_OPEN_PATTERN = re.compile(r"^\s*#\s*if")
+CONDITIONAL_CLOSE_PATTERN = re.compile(r"^\s*#\s*endif")
 
 CLARGS_ASCII_ART = r"""
 
@@ -55,7 +57,18 @@ def parse_dependencies(headers):
     for file, path in headers.items():
         logger.verbose_log(f"Discovering dependencies for header '{file}':")
         with open(path, "r") as f:
+            # The header guard opens the first conditional, system includes
+            # nested deeper are platform specific and stay where they are
+            conditional_depth = 0
             for line in f:
+                if CONDITIONAL_OPEN_PATTERN.match(line):
+                    conditional_depth += 1
+                elif CONDITIONAL_CLOSE_PATTERN.match(line):
+                    conditional_depth -= 1
+                elif conditional_depth > 1 and SYSTEM_INCLUDE_PATTERN.search(line):
+                    logger.verbose_log(f" - {line.strip()} (Conditional, kept in place)")
+                    continue
+
                 match = CLARGS_INCLUDE_PATTERN.search(line)
                 if match:
                     include_file = match.group(1)
@@ -102,9 +115,22 @@ def resolve_order(headers, clargs_dependencies):
 
 
 def strip_header_includes(content):
-    content_str = "".join(content)
-    cleaned_content = re.sub(r"#include <(?:CLArgs/\w+\.hpp|[\w/]+)>", "", content_str)
-    return cleaned_content.splitlines(keepends=True)
+    # Like in parse_dependencies(), system includes nested in a conditional
+    # other than the header guard are kept
+    result = []
+    conditional_depth = 0
+    for line in content:
+        if CONDITIONAL_OPEN_PATTERN.match(line):
+            conditional_depth += 1
+        elif CONDITIONAL_CLOSE_PATTERN.match(line):
+            conditional_depth -= 1
+
+        if CLARGS_INCLUDE_PATTERN.search(line):
+            continue
+        if conditional_depth <= 1 and SYSTEM_INCLUDE_PATTERN.search(line):
+            continue
+        result.append(line)
+    return result
 
 
 def strip_header_guards(content):
@@ -160,10 +186,10 @@ def create_single_header(headers, system_dependencies, license_path, add_warning
         with open(path, "r") as f:
             logger.verbose_log("   - Reading content")
             content = f.readlines()
-            logger.verbose_log("   - Removing header guards")
-            content = strip_header_guards(content)
             logger.verbose_log("   - Removing includes")
             content = strip_header_includes(content)
+            logger.verbose_log("   - Removing header guards")
+            content = strip_header_guards(content)
             logger.verbose_log("   - Adding to result")
             result.extend(content)
             result.append("\n")
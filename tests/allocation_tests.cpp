@@ -0,0 +1,152 @@
+#include <CLArgs/parser_builder.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+namespace
+{
+    // Only allocations made by the thread that created a counter, while it
+    // exists, are counted, so Catch2 and other threads are never included
+    thread_local bool        counting_allocations{false};
+    thread_local std::size_t allocation_count{0};
+
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter() noexcept
+        {
+            allocation_count     = 0;
+            counting_allocations = true;
+        }
+
+        ~AllocationCounter()
+        {
+            counting_allocations = false;
+        }
+
+        AllocationCounter(const AllocationCounter &)            = delete;
+        AllocationCounter &operator=(const AllocationCounter &) = delete;
+
+        [[nodiscard]] std::size_t
+        count() const noexcept
+        {
+            return allocation_count;
+        }
+    };
+
+    void
+    count_allocation() noexcept
+    {
+        if (counting_allocations)
+        {
+            ++allocation_count;
+        }
+    }
+} // namespace
+
+void *
+operator new(const std::size_t size)
+{
+    count_allocation();
+    if (void *ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void *
+operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    count_allocation();
+    const auto align = static_cast<std::size_t>(alignment);
+    if (void *ptr = std::aligned_alloc(align, ((size + align - 1) / align) * align))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void
+operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+using VerboseFlag   = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+using NameOption    = CLArgs::Option<"--name", "<name>", "Specify name", std::pmr::string>;
+using HostOption    = CLArgs::Option<"--host", "<host>", "Specify host", std::pmr::string, "a-default-host-name-longer-than-sso">;
+using ThreadsOption = CLArgs::Option<"--threads", "<number>", "Specify thread count", std::uint16_t>;
+
+TEST_CASE("Parser performs no global allocations when given a memory resource", "[allocation]")
+{
+    constexpr std::array args = {"program", "-v", "--name", "a-name-that-is-much-longer-than-sso", "--threads", "8"};
+    auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+    std::array<std::byte, 4096>         buffer{};
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    {
+        const AllocationCounter counter;
+
+        auto parser = CLArgs::ParserBuilder{}
+                          .add_flag<VerboseFlag>()
+                          .add_option<NameOption>()
+                          .add_option<HostOption>()
+                          .add_option<ThreadsOption>()
+                          .build(&resource);
+
+        parser.parse(argc, argv);
+        parser.parse_command_line("program", "--name 'another name that is longer than sso' --threads 4");
+
+        const bool name_matches  = parser.get_option<NameOption>().value() == "another name that is longer than sso";
+        const bool host_matches  = parser.get<HostOption>() == "a-default-host-name-longer-than-sso";
+        const bool uses_resource = parser.get_option<NameOption>().value().get_allocator().resource() == &resource;
+
+        const std::size_t global_allocations = counter.count();
+
+        CHECK(name_matches);
+        CHECK(host_matches);
+        CHECK(uses_resource);
+        CHECK(global_allocations == 0);
+    }
+}
+
+TEST_CASE("Parser values use the global heap without a memory resource", "[allocation]")
+{
+    constexpr std::array args = {"program", "--name", "a-name-that-is-much-longer-than-sso"};
+    auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+    const AllocationCounter counter;
+
+    auto parser = CLArgs::ParserBuilder{}.add_option<NameOption>().build();
+    parser.parse(argc, argv);
+
+    CHECK(counter.count() > 0);
+}
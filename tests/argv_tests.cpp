@@ -0,0 +1,171 @@
+#include <CLArgs/argv.hpp>
+#include <CLArgs/inline_vector.hpp>
+#include <CLArgs/parser_builder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+    using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+    using DryRunFlag  = CLArgs::Flag<"--dry-run,-n", "Do not change anything">;
+    using PortOption  = CLArgs::Option<"--port,-p", "PORT", "Port to listen on", std::uint16_t>;
+    using RatioOption = CLArgs::Option<"--ratio", "R", "Ratio", double, 0.5>;
+    using DelayOption = CLArgs::Option<"--delay", "MS", "Delay", std::chrono::milliseconds>;
+    using NameOption  = CLArgs::Option<"--name", "NAME", "Name", std::string>;
+    using TagsOption  = CLArgs::Option<"--tags", "TAG,...", "Tags", CLArgs::InlineVector<std::string_view, 2>>;
+
+    auto
+    make_builder()
+    {
+        return CLArgs::ParserBuilder{}
+            .add_flag<VerboseFlag>()
+            .add_flag<DryRunFlag>()
+            .add_option<PortOption>()
+            .add_option<RatioOption>()
+            .add_option<DelayOption>()
+            .add_option<NameOption>();
+    }
+
+    class CountingResource final : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{0};
+
+    private:
+        void *
+        do_allocate(const std::size_t bytes, const std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void
+        do_deallocate(void *ptr, const std::size_t bytes, const std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool
+        do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+} // namespace
+
+TEST_CASE("to_argv renders explicitly set values with their first identifier", "[argv]")
+{
+    auto parser = make_builder().build();
+    parser.parse("worker", std::array{"-v", "-p", "8080", "--delay", "250", "--name", "first worker"});
+
+    const CLArgs::Argv argv = parser.to_argv();
+
+    REQUIRE(argv.size() == 8);
+    REQUIRE(argv[0] == "worker");
+    REQUIRE(argv[1] == "--verbose");
+    REQUIRE(argv[2] == "--port");
+    REQUIRE(argv[3] == "8080");
+    REQUIRE(argv[4] == "--delay");
+    REQUIRE(argv[5] == "250");
+    REQUIRE(argv[6] == "--name");
+    REQUIRE(argv[7] == "first worker");
+    REQUIRE(argv.data()[argv.size()] == nullptr);
+}
+
+TEST_CASE("to_argv round-trips through the parser", "[argv]")
+{
+    auto parser = make_builder().build();
+    parser.parse("worker", std::array{"-n", "--ratio", "0.1", "--port", "65535"});
+
+    const CLArgs::Argv argv = parser.to_argv();
+
+    auto reparsed = make_builder().build();
+    reparsed.parse(static_cast<int>(argv.size()), const_cast<char **>(argv.data()));
+
+    REQUIRE(reparsed.has_flag<DryRunFlag>());
+    REQUIRE_FALSE(reparsed.has_flag<VerboseFlag>());
+    REQUIRE(reparsed.get<RatioOption>() == 0.1);
+    REQUIRE(reparsed.get_option<PortOption>() == 65535);
+    REQUIRE_FALSE(reparsed.get_option<NameOption>().has_value());
+}
+
+TEST_CASE("to_argv applies overrides", "[argv]")
+{
+    auto parser = make_builder().build();
+    parser.parse("coordinator", std::array{"-v", "--port", "8080", "--name", "coordinator"});
+
+    const CLArgs::Argv argv = parser.to_argv(CLArgs::override_value<PortOption>(8081),
+                                             CLArgs::omit_value<NameOption>,
+                                             CLArgs::override_value<VerboseFlag>(false),
+                                             CLArgs::override_value<DryRunFlag>(true),
+                                             CLArgs::override_value<DelayOption>(std::chrono::milliseconds{10}));
+
+    REQUIRE(argv.size() == 6);
+    REQUIRE(argv[0] == "coordinator");
+    REQUIRE(argv[1] == "--dry-run");
+    REQUIRE(argv[2] == "--port");
+    REQUIRE(argv[3] == "8081");
+    REQUIRE(argv[4] == "--delay");
+    REQUIRE(argv[5] == "10");
+}
+
+TEST_CASE("to_argv rejects list elements containing the delimiter", "[argv]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_option<TagsOption>().build();
+    parser.parse("worker", std::array{"--tags", "a,b"});
+
+    const CLArgs::Argv argv = parser.to_argv();
+    REQUIRE(argv.size() == 3);
+    REQUIRE(argv[2] == "a,b");
+
+    CLArgs::InlineVector<std::string_view, 2> tags;
+    tags.push_back("a,b");
+    CHECK_THROWS_AS((void)parser.to_argv(CLArgs::override_value<TagsOption>(tags)), std::invalid_argument);
+
+    tags = {};
+    tags.push_back("a");
+    tags.push_back("b");
+    const CLArgs::Argv split = parser.to_argv(CLArgs::override_value<TagsOption>(tags));
+    REQUIRE(split[2] == "a,b");
+}
+
+TEST_CASE("to_argv allocates twice", "[argv]")
+{
+    CountingResource resource;
+
+    auto parser = make_builder().build(&resource);
+    parser.parse("worker", std::array{"-v", "--port", "1", "--name", "a name that does not fit into the small string buffer"});
+
+    resource.allocations = 0;
+    const CLArgs::Argv argv = parser.to_argv();
+
+    REQUIRE(argv.size() == 6);
+    REQUIRE(resource.allocations == 2);
+}
+
+TEST_CASE("Argv keeps its tokens when moved", "[argv]")
+{
+    auto parser = make_builder().build();
+    parser.parse("worker", std::array{"--port", "1"});
+
+    CLArgs::Argv       original = parser.to_argv();
+    const char *const  port     = original.data()[2];
+    const CLArgs::Argv moved{std::move(original)};
+
+    REQUIRE(moved.size() == 3);
+    REQUIRE(moved.data()[2] == port);
+    REQUIRE(moved.data()[3] == nullptr);
+
+    // The size of the moved-from Argv must not wrap around
+    REQUIRE(original.size() == 0); // NOLINT(bugprone-use-after-move)
+}
@@ -0,0 +1,203 @@
+#include <CLArgs/argv.hpp>
+#include <CLArgs/binding.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    struct Config
+    {
+        std::uint32_t         threads{1};
+        std::string           host{"unset"};
+        std::pmr::string      name{};
+        std::filesystem::path output{};
+        bool                  verbose{false};
+    };
+
+    struct OtherConfig
+    {
+        std::uint32_t threads{0};
+    };
+
+    class CountingResource final : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{0};
+
+    private:
+        void *
+        do_allocate(const std::size_t bytes, const std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void
+        do_deallocate(void *ptr, const std::size_t bytes, const std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool
+        do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+} // namespace
+
+using ThreadsOption = CLArgs::Option<"--threads,-t", "<count>", "Worker threads", std::uint32_t>;
+using HostOption    = CLArgs::Option<"--host", "<host>", "Host to connect to", std::string, "localhost">;
+using NameOption    = CLArgs::Option<"--name", "<name>", "Name of the service", std::pmr::string>;
+using OutputOption  = CLArgs::Option<"--output,-o", "<path>", "Output directory", std::filesystem::path>;
+using VerboseFlag   = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+using RetriesOption = CLArgs::Option<"--retries", "<count>", "Retries before giving up", std::uint32_t>;
+
+using BoundThreads = CLArgs::Bound<ThreadsOption, &Config::threads>;
+using BoundHost    = CLArgs::Bound<HostOption, &Config::host>;
+using BoundName    = CLArgs::Bound<NameOption, &Config::name>;
+using BoundOutput  = CLArgs::Bound<OutputOption, &Config::output>;
+using BoundVerbose = CLArgs::Bound<VerboseFlag, &Config::verbose>;
+
+TEST_CASE("Bound Parsables keep the identifiers of their member", "[binding]")
+{
+    STATIC_REQUIRE(CLArgs::BoundParsable<BoundThreads>);
+    STATIC_REQUIRE(CLArgs::BoundParsable<BoundVerbose>);
+    STATIC_REQUIRE_FALSE(CLArgs::BoundParsable<ThreadsOption>);
+    STATIC_REQUIRE(CLArgs::all_flags_v<BoundVerbose>);
+    STATIC_REQUIRE(CLArgs::CmdOptionWithDefault<BoundHost>);
+    STATIC_REQUIRE(BoundOutput::identifiers[1] == "-o");
+
+    STATIC_REQUIRE(CLArgs::binds_to_v<Config, BoundThreads, BoundVerbose, RetriesOption>);
+    STATIC_REQUIRE_FALSE(CLArgs::binds_to_v<OtherConfig, BoundThreads>);
+    STATIC_REQUIRE(CLArgs::binds_to_v<OtherConfig, CLArgs::Bound<ThreadsOption, &OtherConfig::threads>>);
+}
+
+TEST_CASE("parse_into() writes values into the config struct", "[binding]")
+{
+    auto parser = CLArgs::ParserBuilder{}
+                      .add_flag<BoundVerbose>()
+                      .add_option<BoundThreads>()
+                      .add_option<BoundHost>()
+                      .add_option<BoundName>()
+                      .add_option<BoundOutput>()
+                      .add_option<RetriesOption>()
+                      .build();
+
+    Config config;
+
+    SECTION("Given values are converted straight into the members")
+    {
+        constexpr std::array args = {"program", "-t", "8", "--name", "a-name-that-is-much-longer-than-sso", "-o", "out", "--retries", "3"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse_into(config, argc, argv));
+
+        CHECK(config.threads == 8);
+        CHECK(config.name == "a-name-that-is-much-longer-than-sso");
+        CHECK(config.output == "out");
+
+        // Only presence is tracked for bound options, unbound ones are stored as usual
+        CHECK_THROWS_AS((void)parser.get_option<BoundThreads>(), std::logic_error);
+        CHECK(parser.get_option<RetriesOption>() == 3u);
+    }
+
+    SECTION("Flags and defaults are assigned when not given")
+    {
+        config.verbose = true;
+
+        REQUIRE_NOTHROW(parser.parse_into(config, "program", std::array{"--threads", "2"}));
+
+        CHECK(config.threads == 2);
+        CHECK(config.host == "localhost");
+        CHECK_FALSE(config.verbose);
+        CHECK(config.output.empty());
+
+        REQUIRE_NOTHROW(parser.parse_into(config, "program", std::array{"--host", "example.org", "-v"}));
+
+        CHECK(config.host == "example.org");
+        CHECK(config.verbose);
+        CHECK(parser.has_flag<BoundVerbose>());
+
+        // Members of options without a default are left as they were
+        CHECK(config.threads == 2);
+    }
+
+    SECTION("Pmr members keep their own memory resource")
+    {
+        std::pmr::monotonic_buffer_resource resource;
+        Config                              pmr_config{.name = std::pmr::string{&resource}};
+
+        REQUIRE_NOTHROW(parser.parse_into(pmr_config, "program", std::array{"--name", "a-name-that-is-much-longer-than-sso"}));
+        CHECK(pmr_config.name == "a-name-that-is-much-longer-than-sso");
+        CHECK(pmr_config.name.get_allocator().resource() == &resource);
+    }
+
+    SECTION("Invalid values are reported like in parse()")
+    {
+        CHECK_THROWS_WITH(parser.parse_into(config, "program", std::array{"--threads", "many"}),
+                          Catch::Matchers::ContainsSubstring("Failed to parse value for option \"--threads\""));
+
+        // A later parse() stores the values in the parser again
+        REQUIRE_NOTHROW(parser.parse("program", std::array{"--threads", "4"}));
+        CHECK(parser.get_option<BoundThreads>() == 4u);
+        CHECK(config.threads == 1);
+    }
+}
+
+TEST_CASE("Parser accessors reject values only held by the config struct", "[binding]")
+{
+    auto builder =
+        CLArgs::ParserBuilder{}.add_flag<BoundVerbose>().add_option<BoundThreads>().add_option<BoundHost>().add_option<BoundOutput>();
+
+    auto   parser = builder.build();
+    Config config;
+    REQUIRE_NOTHROW(parser.parse_into(config, "program", std::array{"-v", "--threads", "8"}));
+
+    // Flags, and options that were not given, are held by the parser as well
+    CHECK(parser.has_flag<BoundVerbose>());
+    CHECK(parser.get<BoundHost>() == config.host);
+    CHECK_FALSE(parser.get_option<BoundOutput>().has_value());
+
+    CHECK_THROWS_WITH((void)parser.get_option<BoundThreads>(), Catch::Matchers::ContainsSubstring("\"--threads\""));
+    CHECK_THROWS_AS((void)parser.snapshot(), std::logic_error);
+    CHECK_THROWS_AS((void)parser.serialize_values(), std::logic_error);
+    CHECK_THROWS_AS((void)parser.to_argv(), std::logic_error);
+
+    // Unless the bound value is supplied or left out
+    const CLArgs::Argv argv = parser.to_argv(CLArgs::override_value<BoundThreads>(config.threads));
+    REQUIRE(argv.size() == 4);
+    CHECK(argv[1] == "--verbose");
+    CHECK(argv[2] == "--threads");
+    CHECK(argv[3] == "8");
+    CHECK(parser.to_argv(CLArgs::omit_value<BoundThreads>).size() == 2);
+
+    // A later parse() stores the values in the parser again
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--threads", "4"}));
+    CHECK(parser.snapshot().get_option<BoundThreads>() == 4u);
+}
+
+TEST_CASE("parse_into() allocates a bound string once", "[binding]")
+{
+    CountingResource resource;
+
+    auto   parser = CLArgs::ParserBuilder{}.add_option<BoundName>().build(&resource);
+    Config config{.name = std::pmr::string{&resource}};
+
+    resource.allocations = 0;
+    REQUIRE_NOTHROW(parser.parse_into(config, "program", std::array{"--name", "a-name-that-is-much-longer-than-sso"}));
+
+    CHECK(config.name == "a-name-that-is-much-longer-than-sso");
+    CHECK(resource.allocations == 1);
+}
@@ -0,0 +1,91 @@
+#include <CLArgs/command_line.hpp>
+#include <CLArgs/parser.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string>
+    tokenize(const std::string_view command_line)
+    {
+        std::string              buffer(command_line.size(), '\0');
+        std::vector<std::string> tokens;
+        for (const std::string_view token : CLArgs::CommandLineTokenizer{command_line, buffer})
+        {
+            tokens.emplace_back(token);
+        }
+        return tokens;
+    }
+} // namespace
+
+TEST_CASE("Tokenizer splits on whitespace", "[command_line]")
+{
+    STATIC_REQUIRE(std::ranges::forward_range<CLArgs::CommandLineTokenizer>);
+    STATIC_REQUIRE(std::ranges::view<CLArgs::CommandLineTokenizer>);
+
+    CHECK(tokenize("").empty());
+    CHECK(tokenize(" \t\n ").empty());
+    CHECK(tokenize("--level debug --tail 100") == std::vector<std::string>{"--level", "debug", "--tail", "100"});
+    CHECK(tokenize("  --level\t\tdebug  ") == std::vector<std::string>{"--level", "debug"});
+}
+
+TEST_CASE("Tokenizer handles quoting and escaping", "[command_line]")
+{
+    CHECK(tokenize(R"(--name 'John Doe')") == std::vector<std::string>{"--name", "John Doe"});
+    CHECK(tokenize(R"(--name "John Doe")") == std::vector<std::string>{"--name", "John Doe"});
+    CHECK(tokenize(R"(--name John\ Doe)") == std::vector<std::string>{"--name", "John Doe"});
+    CHECK(tokenize(R"('' "")") == std::vector<std::string>{"", ""});
+    CHECK(tokenize(R"(pre'fix'"suf"fix)") == std::vector<std::string>{"prefixsuffix"});
+    CHECK(tokenize(R"('a\b "c"')") == std::vector<std::string>{R"(a\b "c")"});
+    CHECK(tokenize(R"("a\"b\\c\d $")") == std::vector<std::string>{R"(a"b\c\d $)"});
+    CHECK(tokenize("a\\\nb") == std::vector<std::string>{"ab"});
+
+    std::string buffer(16, '\0');
+    CHECK_THROWS_AS(tokenize(R"(--name 'John)"), std::invalid_argument);
+    CHECK_THROWS_AS(tokenize(R"(--name "John)"), std::invalid_argument);
+    CHECK_THROWS_AS(tokenize(R"(--name John\)"), std::invalid_argument);
+    CHECK_THROWS_AS(CLArgs::CommandLineTokenizer(std::string_view{"this is too long for the buffer"}, buffer), std::invalid_argument);
+}
+
+using LevelOption = CLArgs::Option<"--level", "<level>", "Specify log level", std::string_view>;
+using TailOption  = CLArgs::Option<"--tail", "<lines>", "Specify number of lines", std::uint32_t>;
+using FollowFlag  = CLArgs::Flag<"--follow,-f", "Follow output">;
+
+TEST_CASE("Parser can parse a single command-line string", "[command_line]")
+{
+    CLArgs::Parser<CLArgs::CmdFlagList<FollowFlag>, CLArgs::CmdOptionList<LevelOption, TailOption>, ""> parser;
+
+    SECTION("Parser-owned buffer")
+    {
+        REQUIRE_NOTHROW(parser.parse_command_line("admin", "--level 'very verbose' --tail 100 -f"));
+        CHECK(parser.program() == "admin");
+        CHECK(parser.get_option<LevelOption>().value() == "very verbose");
+        CHECK(parser.get_option<TailOption>().value() == 100);
+        CHECK(parser.has_flag<FollowFlag>());
+    }
+
+    SECTION("Caller-supplied buffer with passthrough")
+    {
+        std::array<char, 64> buffer{};
+        const auto           passthrough = parser.parse_command_line("admin", "--tail 5 -- tail -f \"log file\"", buffer);
+        CHECK(parser.get_option<TailOption>().value() == 5);
+        CHECK_FALSE(parser.has_flag<FollowFlag>());
+
+        std::vector<std::string_view> remaining(passthrough.begin(), passthrough.end());
+        CHECK(remaining == std::vector<std::string_view>{"tail", "-f", "log file"});
+    }
+
+    SECTION("Tokenizer errors are reported")
+    {
+        CHECK_THROWS_AS(parser.parse_command_line("admin", "--level \"debug"), std::invalid_argument);
+    }
+}
@@ -72,6 +72,7 @@ TEST_CASE("Parser with CommonFlags::Force", "[common_flags]")
 
 TEST_CASE("Parser with CommonFlags::Help", "[common_flags]")
 {
+    STATIC_REQUIRE(CLArgs::TerminatingFlag<CLArgs::CommonFlags::Help>);
     test_flag<CLArgs::CommonFlags::Help, "--help", "-h">();
 }
 
@@ -107,5 +108,6 @@ TEST_CASE("Parser with CommonFlags::Verbose", "[common_flags]")
 
 TEST_CASE("Parser with CommonFlags::Version", "[common_flags]")
 {
+    STATIC_REQUIRE(CLArgs::TerminatingFlag<CLArgs::CommonFlags::Version>);
     test_flag<CLArgs::CommonFlags::Version, "--version">();
 }
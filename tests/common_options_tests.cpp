@@ -80,6 +80,11 @@ TEST_CASE("Parser with CommonOptions::Port", "[common_options]")
     test_option<CLArgs::CommonOptions::Port, "6969", "--port">();
 }
 
+TEST_CASE("Parser with CommonOptions::Endpoint", "[common_options]")
+{
+    test_option<CLArgs::CommonOptions::Endpoint, "[::1]:6969", "--endpoint">();
+}
+
 TEST_CASE("Parser with CommonOptions::Threads", "[common_options]")
 {
     test_option<CLArgs::CommonOptions::Threads, "12", "--threads">();
@@ -0,0 +1,174 @@
+#include <CLArgs/completion.hpp>
+#include <CLArgs/core.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using VerboseFlag  = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+using VersionFlag  = CLArgs::Flag<"--version", "Show program version">;
+using ConfigOption = CLArgs::Option<"--config,--configuration,-c", "<filepath>", "Specify config file", std::filesystem::path>;
+
+TEST_CASE("Identifier table is sorted and contains every identifier", "[completion]")
+{
+    constexpr auto table = CLArgs::sorted_identifier_table<VerboseFlag, VersionFlag, ConfigOption>();
+
+    STATIC_REQUIRE(table.size() == 6);
+    STATIC_REQUIRE(std::ranges::is_sorted(table));
+
+    for (const auto identifier : {"--verbose", "-v", "--version", "--config", "--configuration", "-c"})
+    {
+        CHECK(std::ranges::binary_search(table, std::string_view{identifier}));
+    }
+}
+
+TEST_CASE("Completion returns all identifiers matching a prefix", "[completion]")
+{
+    constexpr auto table = CLArgs::sorted_identifier_table<VerboseFlag, VersionFlag, ConfigOption>();
+
+    SECTION("Empty prefix matches everything")
+    {
+        CHECK(CLArgs::complete(table, "").size() == table.size());
+    }
+
+    SECTION("Shared prefix matches several identifiers")
+    {
+        const auto matches = CLArgs::complete(table, "--ver");
+        REQUIRE(matches.size() == 2);
+        CHECK(matches[0] == "--verbose");
+        CHECK(matches[1] == "--version");
+    }
+
+    SECTION("Full identifier matches itself and longer identifiers")
+    {
+        const auto matches = CLArgs::complete(table, "--config");
+        REQUIRE(matches.size() == 2);
+        CHECK(matches[0] == "--config");
+        CHECK(matches[1] == "--configuration");
+    }
+
+    SECTION("Unknown prefix matches nothing")
+    {
+        CHECK(CLArgs::complete(table, "--unknown").empty());
+        CHECK(CLArgs::complete(table, "x").empty());
+    }
+}
+
+TEST_CASE("Completion scripts invoke the completion protocol", "[completion]")
+{
+    const std::string bash = CLArgs::bash_completion_script("./my-tool");
+    CHECK(bash.find("_clargs_complete_my_tool()") != std::string::npos);
+    CHECK(bash.find("'./my-tool' --__complete") != std::string::npos);
+    CHECK(bash.find("complete -o default -F _clargs_complete_my_tool './my-tool'") != std::string::npos);
+
+    const std::string zsh = CLArgs::zsh_completion_script("my-tool");
+    CHECK(zsh.find("'my-tool' --__complete") != std::string::npos);
+    CHECK(zsh.find("compdef _clargs_complete_my_tool 'my-tool'") != std::string::npos);
+}
+
+TEST_CASE("Completion scripts quote the program path for the shell", "[completion]")
+{
+    CHECK(CLArgs::shell_quote("") == "''");
+    CHECK(CLArgs::shell_quote("/opt/my tool/bin") == "'/opt/my tool/bin'");
+    CHECK(CLArgs::shell_quote("it's") == "'it'\\''s'");
+
+    // Nothing in the path may be expanded when the script is sourced
+    const std::string program{"/tmp/\"$(touch pwned)`id`\"/it's"};
+    const std::string quoted{"'/tmp/\"$(touch pwned)`id`\"/it'\\''s'"};
+
+    CHECK(CLArgs::bash_completion_script(program).find(quoted + " --__complete") != std::string::npos);
+    CHECK(CLArgs::zsh_completion_script(program).find("compdef _clargs_complete_it_s " + quoted) != std::string::npos);
+}
+
+TEST_CASE("Parser reports completion requests to the caller", "[completion]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_flag<VerboseFlag>().add_flag<VersionFlag>().add_option<ConfigOption>().build();
+
+    SECTION("A completion request is not parsed as arguments")
+    {
+        constexpr std::array args = {"program", "--__complete", "--ver"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+
+        CHECK(parser.completion_requested());
+        REQUIRE(parser.completions().size() == 2);
+        CHECK(parser.completions()[0] == "--verbose");
+        CHECK(parser.completions()[1] == "--version");
+        CHECK_FALSE(parser.has_flag<VerboseFlag>());
+
+        std::FILE *const stream = std::tmpfile();
+        REQUIRE(stream != nullptr);
+        parser.write_completions(stream);
+
+        std::rewind(stream);
+        std::array<char, 64> written{};
+        const std::size_t    size = std::fread(written.data(), 1, written.size(), stream);
+        std::fclose(stream);
+        CHECK(std::string_view{written.data(), size} == "--verbose\n--version\n");
+    }
+
+    SECTION("Without a partial argument, every identifier completes")
+    {
+        constexpr std::array args = {"program", "--__complete"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.completion_requested());
+        CHECK(parser.completions().size() == 6);
+    }
+
+    SECTION("Every entry point recognizes a completion request")
+    {
+        const auto check_request = [&parser]
+        {
+            CHECK(parser.completion_requested());
+            REQUIRE(parser.completions().size() == 2);
+            CHECK(parser.completions()[0] == "--config");
+            CHECK(parser.completions()[1] == "--configuration");
+            CHECK_FALSE(parser.has_flag<VerboseFlag>());
+        };
+
+        REQUIRE_NOTHROW(parser.parse("program", std::array{"--__complete", "--conf", "-v"}));
+        check_request();
+
+        REQUIRE(parser.parse_command_line("program", "--__complete --conf -v").empty());
+        check_request();
+
+        parser.begin("program");
+        CHECK(parser.feed("--__complete") == CLArgs::FeedResult::Consumed);
+        CHECK(parser.feed("--conf") == CLArgs::FeedResult::Consumed);
+        CHECK(parser.feed("-v") == CLArgs::FeedResult::Ignored);
+        REQUIRE_NOTHROW(parser.finish());
+        check_request();
+
+        // Only as the first argument
+        CHECK_THROWS_AS(parser.parse("program", std::array{"-v", "--__complete"}), std::invalid_argument);
+        parser.begin("program");
+        CHECK(parser.feed("-v") == CLArgs::FeedResult::Consumed);
+        CHECK_THROWS_AS(parser.feed("--__complete"), std::invalid_argument);
+    }
+
+    SECTION("Regular arguments clear a previous request")
+    {
+        constexpr std::array request      = {"program", "--__complete", "-"};
+        auto [request_argc, request_argv] = CLArgs::Testing::create_argc_argv_from_array(request);
+        REQUIRE_NOTHROW(parser.parse(request_argc, request_argv));
+
+        constexpr std::array args = {"program", "-v"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+
+        CHECK_FALSE(parser.completion_requested());
+        CHECK(parser.completions().empty());
+        CHECK(parser.has_flag<VerboseFlag>());
+    }
+}
@@ -0,0 +1,188 @@
+#include <CLArgs/constraints.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+using HelpFlag    = CLArgs::Flag<"--help,-h", "Show help menu", CLArgs::FlagBehavior::Terminating>;
+using JsonFlag    = CLArgs::Flag<"--json", "Print as JSON">;
+using YamlFlag    = CLArgs::Flag<"--yaml", "Print as YAML">;
+using TlsFlag     = CLArgs::Flag<"--tls", "Enable TLS">;
+using InputOption = CLArgs::Option<"--input,-i", "<filepath>", "Specify input file", std::filesystem::path>;
+using UrlOption   = CLArgs::Option<"--url", "<url>", "Specify input URL", std::string>;
+using CertOption  = CLArgs::Option<"--cert", "<filepath>", "Specify certificate", std::filesystem::path>;
+using KeyOption   = CLArgs::Option<"--key", "<filepath>", "Specify private key", std::filesystem::path>;
+using PortOption  = CLArgs::Option<"--port", "<port>", "Specify port", std::uint16_t>;
+
+TEST_CASE("Presence masks select the bits of their members", "[constraints]")
+{
+    using Container = CLArgs::ValueContainer<JsonFlag, YamlFlag, InputOption, UrlOption>;
+
+    STATIC_REQUIRE(Container::presence_words == 1);
+    STATIC_REQUIRE(Container::presence_mask<JsonFlag>()[0] == 0b0001);
+    STATIC_REQUIRE(Container::presence_mask<YamlFlag, UrlOption>()[0] == 0b1010);
+    STATIC_REQUIRE(Container::presence_mask<>()[0] == 0);
+
+    Container container;
+    REQUIRE(container.presence()[0] == 0);
+
+    container.set_value<UrlOption>("https://example.com");
+    REQUIRE(container.presence()[0] == 0b1000);
+}
+
+TEST_CASE("Constraints are checked against presence bits", "[constraints]")
+{
+    using Container = CLArgs::ValueContainer<JsonFlag, YamlFlag, InputOption, UrlOption>;
+
+    const auto satisfied = []<typename C>(const Container &values)
+    {
+        return CLArgs::ConstraintChecker<C, Container>::is_satisfied(values.presence());
+    };
+
+    Container none;
+
+    Container json;
+    json.set_value<JsonFlag>(true);
+
+    Container json_yaml;
+    json_yaml.set_value<JsonFlag>(true);
+    json_yaml.set_value<YamlFlag>(true);
+
+    SECTION("Required")
+    {
+        using C = CLArgs::Required<JsonFlag, YamlFlag>;
+        CHECK_FALSE(satisfied.operator()<C>(none));
+        CHECK_FALSE(satisfied.operator()<C>(json));
+        CHECK(satisfied.operator()<C>(json_yaml));
+    }
+
+    SECTION("ExactlyOneOf")
+    {
+        using C = CLArgs::ExactlyOneOf<JsonFlag, YamlFlag>;
+        CHECK_FALSE(satisfied.operator()<C>(none));
+        CHECK(satisfied.operator()<C>(json));
+        CHECK_FALSE(satisfied.operator()<C>(json_yaml));
+    }
+
+    SECTION("MutuallyExclusive")
+    {
+        using C = CLArgs::MutuallyExclusive<JsonFlag, YamlFlag>;
+        CHECK(satisfied.operator()<C>(none));
+        CHECK(satisfied.operator()<C>(json));
+        CHECK_FALSE(satisfied.operator()<C>(json_yaml));
+    }
+
+    SECTION("AtLeastOneOf")
+    {
+        using C = CLArgs::AtLeastOneOf<JsonFlag, YamlFlag>;
+        CHECK_FALSE(satisfied.operator()<C>(none));
+        CHECK(satisfied.operator()<C>(json));
+        CHECK(satisfied.operator()<C>(json_yaml));
+    }
+
+    SECTION("Requires")
+    {
+        using C = CLArgs::Requires<JsonFlag, YamlFlag>;
+        CHECK(satisfied.operator()<C>(none));
+        CHECK_FALSE(satisfied.operator()<C>(json));
+        CHECK(satisfied.operator()<C>(json_yaml));
+    }
+}
+
+TEST_CASE("Parser enforces constraints after parsing", "[constraints]")
+{
+    auto parser = CLArgs::ParserBuilder{}
+                      .add_flag<HelpFlag>()
+                      .add_flag<JsonFlag>()
+                      .add_flag<YamlFlag>()
+                      .add_flag<TlsFlag>()
+                      .add_option<InputOption>()
+                      .add_option<UrlOption>()
+                      .add_option<CertOption>()
+                      .add_option<KeyOption>()
+                      .add_option<PortOption>()
+                      .add_constraint<CLArgs::ExactlyOneOf<InputOption, UrlOption>>()
+                      .add_constraint<CLArgs::MutuallyExclusive<JsonFlag, YamlFlag>>()
+                      .add_constraint<CLArgs::Requires<TlsFlag, CertOption, KeyOption>>()
+                      .add_constraint<CLArgs::Required<PortOption>>()
+                      .build();
+
+    SECTION("Satisfied constraints")
+    {
+        constexpr std::array args = {"program", "--url", "localhost", "--tls", "--cert", "a.pem", "--key", "b.pem", "--port", "443"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.has_flag<TlsFlag>());
+        CHECK(parser.get_option<PortOption>() == 443);
+    }
+
+    SECTION("Missing required option")
+    {
+        constexpr std::array args = {"program", "-i", "in.txt"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_THROWS_WITH(parser.parse(argc, argv), "Missing required argument \"--port\"");
+    }
+
+    SECTION("None of exactly one")
+    {
+        constexpr std::array args = {"program", "--port", "80"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_THROWS_WITH(parser.parse(argc, argv), "Expected one of \"--input\", \"--url\"");
+    }
+
+    SECTION("Mutually exclusive flags")
+    {
+        constexpr std::array args = {"program", "-i", "in.txt", "--port", "80", "--yaml", "--json"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_THROWS_WITH(parser.parse(argc, argv), "Arguments \"--json\", \"--yaml\" cannot be combined");
+    }
+
+    SECTION("Missing dependencies")
+    {
+        constexpr std::array args = {"program", "-i", "in.txt", "--port", "80", "--tls", "--key", "b.pem"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_THROWS_WITH(parser.parse(argc, argv), "Argument \"--tls\" requires \"--cert\"");
+    }
+
+    SECTION("Constraints are checked after end of options")
+    {
+        constexpr std::array args = {"program", "-i", "in.txt", "--", "--port", "80"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_THROWS_WITH(parser.parse(argc, argv), Catch::Matchers::ContainsSubstring("--port"));
+    }
+
+    SECTION("Terminating flag skips constraints")
+    {
+        constexpr std::array args = {"program", "--json", "--yaml", "--help"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.has_flag<HelpFlag>());
+    }
+
+    SECTION("Push parsing checks constraints in finish()")
+    {
+        parser.begin("program");
+        parser.feed("--url");
+        parser.feed("https://example.com");
+        REQUIRE_THROWS_WITH(parser.finish(), "Missing required argument \"--port\"");
+
+        parser.begin("program");
+        parser.feed("--help");
+        parser.feed("--json");
+        parser.feed("--yaml");
+        REQUIRE_NOTHROW(parser.finish());
+    }
+}
@@ -0,0 +1,165 @@
+#include <CLArgs/common_options.hpp>
+#include <CLArgs/cpu_set.hpp>
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/parser_builder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    CLArgs::CpuSet
+    cpus(const std::initializer_list<std::size_t> numbers)
+    {
+        CLArgs::CpuSet set;
+        for (const std::size_t cpu : numbers)
+        {
+            set.set(cpu);
+        }
+        return set;
+    }
+
+    CLArgs::CpuSet
+    parse(const std::string_view sv)
+    {
+        CLArgs::CpuSet set;
+        REQUIRE(CLArgs::parse_cpu_list(sv, set));
+        return set;
+    }
+
+    CLArgs::ValueParseResult
+    parse_error(const std::string_view sv, const CLArgs::CpuSet *allowed = nullptr)
+    {
+        CLArgs::CpuSet set;
+        return CLArgs::parse_cpu_list(sv, set, allowed);
+    }
+
+    std::string
+    format(const CLArgs::CpuSet &set)
+    {
+        std::string result(CLArgs::format_value(set, nullptr), '\0');
+        CLArgs::format_value(set, result.data());
+        return result;
+    }
+} // namespace
+
+TEST_CASE("CpuSet holds CPU numbers as bits", "[cpu_set]")
+{
+    CLArgs::CpuSet set;
+    CHECK(set.empty());
+
+    set.set(0);
+    set.set(63);
+    set.set(64);
+    set.set(1023);
+    CHECK(set.count() == 4);
+    CHECK(set.test(63));
+    CHECK(set.test(64));
+    CHECK_FALSE(set.test(62));
+    CHECK_FALSE(set.test(1024));
+
+    set.reset(63);
+    CHECK_FALSE(set.test(63));
+    CHECK(cpus({0, 64}).is_subset_of(set));
+    CHECK_FALSE(cpus({0, 63}).is_subset_of(set));
+}
+
+TEST_CASE("Parse CPU lists", "[cpu_set]")
+{
+    CHECK(parse("5") == cpus({5}));
+    CHECK(parse("0-3,8-11,16") == cpus({0, 1, 2, 3, 8, 9, 10, 11, 16}));
+    CHECK(parse("0-9:3") == cpus({0, 3, 6, 9}));
+    CHECK(parse("0-15:2/8") == cpus({0, 1, 8, 9}));
+    CHECK(parse("0-9:2/4") == cpus({0, 1, 4, 5, 8, 9}));
+    CHECK(parse("3,3,1-3") == cpus({1, 2, 3}));
+    CHECK(parse("0-1023").count() == 1024);
+
+    constexpr auto parse_at_compile_time = [](const std::string_view sv)
+    {
+        CLArgs::CpuSet set;
+        return CLArgs::parse_cpu_list(sv, set) ? set.count() : 0;
+    };
+    STATIC_REQUIRE(parse_at_compile_time("0-31:2") == 16);
+}
+
+TEST_CASE("Malformed CPU lists are rejected at the offending character", "[cpu_set]")
+{
+    CHECK(parse_error("").error_offset == 0);
+    CHECK(parse_error("1,").error_offset == 2);
+    CHECK(parse_error("1,,2").error_offset == 2);
+    CHECK(parse_error("0-").error_offset == 2);
+    CHECK(parse_error("a").error_offset == 0);
+    CHECK(parse_error("1 2").error_offset == 1);
+    CHECK(parse_error("7-3").error_offset == 0);
+    CHECK(parse_error("0-7:0").error_offset == 4);
+    CHECK(parse_error("0-7:4/2").error_offset == 4);
+    CHECK(parse_error("0-7:2/").error_offset == 6);
+    CHECK(parse_error("3:2").error_offset == 1);
+
+    CHECK(parse_error("1024").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse_error("0-99999999").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse_error("0,1-2000").error_offset == 4);
+}
+
+TEST_CASE("CPU lists are checked against the allowed CPUs", "[cpu_set]")
+{
+    const CLArgs::CpuSet allowed = cpus({0, 1, 2, 3});
+
+    CHECK(parse_error("0-3", &allowed));
+    CHECK(parse_error("0-7:4", &allowed).error_offset == 0);
+
+    const auto result = parse_error("1,2-5", &allowed);
+    CHECK(result.status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(result.error_offset == 2);
+    CHECK(result.message == "CPU is not in the affinity mask of the process");
+}
+
+TEST_CASE("Format CPU lists", "[cpu_set]")
+{
+    CHECK(format(CLArgs::CpuSet{}).empty());
+    CHECK(format(cpus({4})) == "4");
+    CHECK(format(cpus({0, 1, 2, 3, 8, 9, 10, 11, 16})) == "0-3,8-11,16");
+    CHECK(format(parse("0-9:3")) == "0,3,6,9");
+    CHECK(format(parse("1000-1023")) == "1000-1023");
+    CHECK(parse(format(parse("0-1023:3"))) == parse("0-1023:3"));
+}
+
+#if defined(__linux__)
+TEST_CASE("CpuSet converts to and from cpu_set_t", "[cpu_set]")
+{
+    const CLArgs::CpuSet set = parse("0,2,65,1023");
+
+    const cpu_set_t native = set.to_cpu_set_t();
+    CHECK(CPU_COUNT(&native) == 4);
+    CHECK(CPU_ISSET(65, &native));
+    CHECK_FALSE(CPU_ISSET(64, &native));
+    CHECK(CLArgs::CpuSet::from_cpu_set_t(native) == set);
+}
+#endif
+
+TEST_CASE("Parser validates CPU lists against the affinity mask", "[cpu_set]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_option<CLArgs::CommonOptions::Cpus>().build();
+
+    const std::optional<CLArgs::CpuSet> affinity = CLArgs::affinity_cpu_set();
+    if (affinity)
+    {
+        const std::string available = format(*affinity);
+        REQUIRE_NOTHROW(parser.parse("program", std::array{"--cpus", available.c_str()}));
+        CHECK(parser.get_option<CLArgs::CommonOptions::Cpus>() == *affinity);
+    }
+
+    if (affinity && !affinity->test(1023))
+    {
+        CHECK_THROWS_WITH(parser.parse("program", std::array{"--cpus", "1023"}),
+                          Catch::Matchers::ContainsSubstring("CPU is not in the affinity mask of the process at offset 0"));
+    }
+}
@@ -0,0 +1,85 @@
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/parse_value.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    template <typename T>
+    std::string
+    format(const T &value)
+    {
+        std::string result(CLArgs::format_value(value, nullptr), '\0');
+        CLArgs::format_value(value, result.data());
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Format values", "[format_value]")
+{
+    REQUIRE(format(true) == "true");
+    REQUIRE(format(false) == "false");
+    REQUIRE(format('x') == "x");
+    REQUIRE(format(-17) == "-17");
+    REQUIRE(format(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+    REQUIRE(format(0.25) == "0.25");
+    REQUIRE(format(std::chrono::seconds{30}) == "30");
+    REQUIRE(format(std::string{"text"}) == "text");
+    REQUIRE(format(std::string_view{"view"}) == "view");
+    REQUIRE(format(std::filesystem::path{"/tmp/file"}) == "/tmp/file");
+}
+
+TEST_CASE("Formatted values parse back to the same value", "[format_value]")
+{
+    constexpr std::array doubles{0.1, 1.0 / 3.0, -2.5e-300, std::numeric_limits<double>::max()};
+    for (const double value : doubles)
+    {
+        REQUIRE(CLArgs::parse_value<double>(format(value)) == value);
+    }
+
+    constexpr std::array floats{0.1f, 1.0f / 3.0f, std::numeric_limits<float>::min()};
+    for (const float value : floats)
+    {
+        REQUIRE(CLArgs::parse_value<float>(format(value)) == value);
+    }
+
+    constexpr std::int64_t min = std::numeric_limits<std::int64_t>::min();
+    REQUIRE(CLArgs::parse_value<std::int64_t>(format(min)) == min);
+    REQUIRE(CLArgs::parse_value<bool>(format(false)) == false);
+}
+
+TEST_CASE("Format lists", "[format_value]")
+{
+    REQUIRE(format(std::array<int, 3>{80, 443, 8080}) == "80,443,8080");
+
+    CLArgs::InlineVector<double, 4> weights;
+    REQUIRE(format(weights).empty());
+    weights.push_back(0.5);
+    REQUIRE(format(weights) == "0.5");
+    weights.push_back(0.25);
+    REQUIRE(format(weights) == "0.5,0.25");
+    REQUIRE(CLArgs::parse_value<CLArgs::InlineVector<double, 4>>(format(weights)) == weights);
+}
+
+TEST_CASE("Detect values formatted with the list delimiter", "[format_value]")
+{
+    REQUIRE(CLArgs::formats_with_list_delimiter(std::string_view{"a,b"}));
+    REQUIRE_FALSE(CLArgs::formats_with_list_delimiter(std::string_view{"a;b"}));
+    REQUIRE(CLArgs::formats_with_list_delimiter(','));
+    REQUIRE_FALSE(CLArgs::formats_with_list_delimiter(-1.5));
+
+    CLArgs::CpuSet cpus;
+    cpus.set(0);
+    cpus.set(1);
+    REQUIRE_FALSE(CLArgs::formats_with_list_delimiter(cpus));
+    cpus.set(8);
+    REQUIRE(CLArgs::formats_with_list_delimiter(cpus));
+}
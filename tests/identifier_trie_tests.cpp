@@ -0,0 +1,46 @@
+#include <CLArgs/core.hpp>
+#include <CLArgs/identifier_trie.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string_view>
+
+namespace
+{
+    using VerboseFlag   = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+    using VersionFlag   = CLArgs::Flag<"--version", "Show version">;
+    using ConfigOption  = CLArgs::Option<"-c,--config,--configuration", "<filepath>", "Specify config file", std::string_view>;
+    using ShortOnlyFlag = CLArgs::Flag<"-x", "Short identifier only">;
+
+    constexpr auto trie = CLArgs::make_identifier_trie<VerboseFlag, VersionFlag, ConfigOption, ShortOnlyFlag>();
+} // namespace
+
+TEST_CASE("Identifier trie resolves unique prefixes", "[identifier_trie]")
+{
+    STATIC_REQUIRE(trie.find_prefix("--verb") == 0);
+    STATIC_REQUIRE(trie.find_prefix("--verbose") == 0);
+    STATIC_REQUIRE(trie.find_prefix("--vers") == 1);
+    STATIC_REQUIRE(trie.find_prefix("--c") == 2);
+
+    // Both identifiers belong to the same option, so this is not ambiguous
+    STATIC_REQUIRE(trie.find_prefix("--config") == 2);
+    STATIC_REQUIRE(trie.find_prefix("--configur") == 2);
+}
+
+TEST_CASE("Identifier trie detects ambiguous and unknown prefixes", "[identifier_trie]")
+{
+    STATIC_REQUIRE(trie.find_prefix("--ver") == trie.ambiguous_target);
+    STATIC_REQUIRE(trie.find_prefix("--") == trie.ambiguous_target);
+    STATIC_REQUIRE(trie.find_prefix("--verbosity") == trie.no_target);
+    STATIC_REQUIRE(trie.find_prefix("--x") == trie.no_target);
+    STATIC_REQUIRE(trie.find_prefix("-x") == trie.no_target);
+}
+
+TEST_CASE("Canonical identifiers prefer long identifiers", "[identifier_trie]")
+{
+    constexpr auto canonical = CLArgs::canonical_identifiers<VerboseFlag, ConfigOption, ShortOnlyFlag>();
+
+    STATIC_REQUIRE(canonical[0] == "--verbose");
+    STATIC_REQUIRE(canonical[1] == "--config");
+    STATIC_REQUIRE(canonical[2] == "-x");
+}
@@ -0,0 +1,62 @@
+#include <CLArgs/inline_vector.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+TEST_CASE("InlineVector stores elements inline", "[inline_vector]")
+{
+    CLArgs::InlineVector<int, 3> vector;
+    REQUIRE(vector.empty());
+    REQUIRE(vector.capacity() == 3);
+
+    vector.push_back(1);
+    vector.push_back(2);
+    REQUIRE(vector.size() == 2);
+    REQUIRE(vector[0] == 1);
+    REQUIRE(vector[1] == 2);
+    REQUIRE(vector.end() - vector.begin() == 2);
+
+    vector.push_back(3);
+    REQUIRE_THROWS_AS(vector.push_back(4), std::length_error);
+    REQUIRE(vector.size() == 3);
+
+    vector.clear();
+    REQUIRE(vector.empty());
+
+    STATIC_REQUIRE(sizeof(CLArgs::InlineVector<int, 3>) <= sizeof(int) * 3 + sizeof(std::size_t) + alignof(std::size_t));
+    STATIC_REQUIRE(std::is_trivially_copyable_v<CLArgs::InlineVector<int, 3>>);
+}
+
+TEST_CASE("InlineVector compares its elements", "[inline_vector]")
+{
+    CLArgs::InlineVector<std::string, 4> a;
+    CLArgs::InlineVector<std::string, 4> b;
+    REQUIRE(a == b);
+
+    a.push_back("first");
+    REQUIRE_FALSE(a == b);
+
+    b.push_back("first");
+    REQUIRE(a == b);
+
+    b.push_back("second");
+    REQUIRE_FALSE(a == b);
+}
+
+TEST_CASE("InlineVector can be used in constant expressions", "[inline_vector]")
+{
+    constexpr auto vector = []
+    {
+        CLArgs::InlineVector<int, 4> result;
+        result.push_back(1);
+        result.push_back(2);
+        return result;
+    }();
+
+    STATIC_REQUIRE(vector.size() == 2);
+    STATIC_REQUIRE(vector[1] == 2);
+}
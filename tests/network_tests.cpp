@@ -0,0 +1,287 @@
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/network.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/parser_builder.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if __has_include(<arpa/inet.h>)
+#include <arpa/inet.h>
+#endif
+
+namespace
+{
+    template <typename T>
+    std::string
+    format(const T &value)
+    {
+        std::string result(CLArgs::format_value(value, nullptr), '\0');
+        CLArgs::format_value(value, result.data());
+        return result;
+    }
+
+    template <typename T>
+    CLArgs::ValueParseResult
+    parse(const std::string_view sv)
+    {
+        T value;
+        return CLArgs::ValueTraits<T>::parse(sv, value);
+    }
+} // namespace
+
+TEST_CASE("Parse IPv4 addresses", "[network]")
+{
+    constexpr auto parse_at_compile_time = [](const std::string_view sv)
+    {
+        CLArgs::Ipv4Address address;
+        return CLArgs::parse_ipv4_address(sv, address) ? address : CLArgs::Ipv4Address{};
+    };
+    STATIC_REQUIRE(parse_at_compile_time("192.0.2.1").bytes == std::array<std::uint8_t, 4>{192, 0, 2, 1});
+
+    CHECK(CLArgs::parse_value<CLArgs::Ipv4Address>("0.0.0.0") == CLArgs::Ipv4Address{});
+    CHECK(CLArgs::parse_value<CLArgs::Ipv4Address>("255.255.255.255").bytes == std::array<std::uint8_t, 4>{255, 255, 255, 255});
+
+    CHECK(parse<CLArgs::Ipv4Address>("").error_offset == 0);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3").error_offset == 5);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3.4.5").error_offset == 7);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2..4").error_offset == 4);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3.256").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3.1000").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3.04").error_offset == 6);
+    CHECK(parse<CLArgs::Ipv4Address>(" 1.2.3.4").error_offset == 0);
+    CHECK(parse<CLArgs::Ipv4Address>("1.2.3.4 ").error_offset == 7);
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Ipv4Address>("10.0.0.300"),
+                      Catch::Matchers::ContainsSubstring("IPv4 address") &&
+                          Catch::Matchers::ContainsSubstring("Number must be at most 255 at offset 7"));
+}
+
+TEST_CASE("Parse IPv6 addresses", "[network]")
+{
+    constexpr auto parse_v6 = [](const std::string_view sv)
+    {
+        return CLArgs::parse_value<CLArgs::Ipv6Address>(sv).bytes;
+    };
+
+    using Bytes = std::array<std::uint8_t, 16>;
+
+    CHECK(parse_v6("::") == Bytes{});
+    CHECK(parse_v6("::1") == Bytes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
+    CHECK(parse_v6("1::") == Bytes{0, 1});
+    CHECK(parse_v6("2001:db8::ff00:42:8329") == Bytes{0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0xff, 0x00, 0x00, 0x42, 0x83, 0x29});
+    CHECK(parse_v6("2001:0DB8:0000:0000:0000:FF00:0042:8329") == parse_v6("2001:db8::ff00:42:8329"));
+    CHECK(parse_v6("::ffff:192.0.2.1") == Bytes{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 0, 2, 1});
+    CHECK(parse_v6("1:2:3:4:5:6:1.2.3.4") == Bytes{0, 1, 0, 2, 0, 3, 0, 4, 0, 5, 0, 6, 1, 2, 3, 4});
+
+    CHECK(parse<CLArgs::Ipv6Address>("").error_offset == 0);
+    CHECK(parse<CLArgs::Ipv6Address>(":1::").error_offset == 0);
+    CHECK(parse<CLArgs::Ipv6Address>("1:2").error_offset == 3);
+    CHECK(parse<CLArgs::Ipv6Address>("1::2::3").error_offset == 4);
+    CHECK(parse<CLArgs::Ipv6Address>("1:").error_offset == 2);
+    CHECK(parse<CLArgs::Ipv6Address>("12345::").error_offset == 0);
+    CHECK(parse<CLArgs::Ipv6Address>("1:2:3:4:5:6:7:8:9").error_offset == 16);
+    CHECK(parse<CLArgs::Ipv6Address>("1:2:3:4::5:6:7:8").error_offset == 16);
+    CHECK(parse<CLArgs::Ipv6Address>("1:2:3:4:5:6:7:1.2.3.4").error_offset == 14);
+    CHECK(parse<CLArgs::Ipv6Address>("::1.2.3").error_offset == 7);
+    CHECK(parse<CLArgs::Ipv6Address>("fe80::1%eth0").error_offset == 7);
+    CHECK(parse<CLArgs::Ipv6Address>("::g").error_offset == 2);
+}
+
+TEST_CASE("Parse IP addresses of either family", "[network]")
+{
+    const auto v4 = CLArgs::parse_value<CLArgs::IpAddress>("127.0.0.1");
+    REQUIRE(v4.is_v4());
+    CHECK(v4.v4().bytes == std::array<std::uint8_t, 4>{127, 0, 0, 1});
+
+    const auto v6 = CLArgs::parse_value<CLArgs::IpAddress>("::1");
+    REQUIRE(v6.is_v6());
+    CHECK(v6.v6().bytes[15] == 1);
+
+    CHECK(v4 != CLArgs::IpAddress{CLArgs::Ipv6Address{}});
+    CHECK_THROWS_AS(CLArgs::parse_value<CLArgs::IpAddress>("localhost"), std::invalid_argument);
+}
+
+TEST_CASE("Parse endpoints", "[network]")
+{
+    const auto v4 = CLArgs::parse_value<CLArgs::Endpoint>("192.0.2.1:8080");
+    CHECK(v4.address == CLArgs::IpAddress{CLArgs::Ipv4Address{{192, 0, 2, 1}}});
+    CHECK(v4.port == 8080);
+
+    const auto v6 = CLArgs::parse_value<CLArgs::Endpoint>("[2001:db8::1]:443");
+    CHECK(v6.address == CLArgs::parse_value<CLArgs::IpAddress>("2001:db8::1"));
+    CHECK(v6.port == 443);
+
+    CHECK(CLArgs::parse_value<CLArgs::Endpoint>("0.0.0.0:0").port == 0);
+    CHECK(CLArgs::parse_value<CLArgs::Endpoint>("[::]:65535").port == 65535);
+
+    CHECK(parse<CLArgs::Endpoint>("192.0.2.1").error_offset == 9);
+    CHECK(parse<CLArgs::Endpoint>("192.0.2.1:").error_offset == 10);
+    CHECK(parse<CLArgs::Endpoint>("192.0.2.1:80a").error_offset == 12);
+    CHECK(parse<CLArgs::Endpoint>("192.0.2.1:65536").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse<CLArgs::Endpoint>("192.0.2.1:9999999999999").status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(parse<CLArgs::Endpoint>("192.0.2:80").error_offset == 7);
+    CHECK(parse<CLArgs::Endpoint>("[::1:80").error_offset == 7);
+    CHECK(parse<CLArgs::Endpoint>("[::1]").error_offset == 5);
+    CHECK(parse<CLArgs::Endpoint>("[::1]-80").error_offset == 5);
+    CHECK(parse<CLArgs::Endpoint>("[::x]:80").error_offset == 3);
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Endpoint>("::1:80"), Catch::Matchers::ContainsSubstring("must be in brackets"));
+}
+
+TEST_CASE("Format addresses and endpoints", "[network]")
+{
+    CHECK(format(CLArgs::Ipv4Address{{10, 0, 100, 255}}) == "10.0.100.255");
+    CHECK(format(CLArgs::Ipv6Address{}) == "::");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("0:0:0:0:0:0:0:1")) == "::1");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("1:0:0:0:0:0:0:0")) == "1::");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("2001:0DB8:0:0:1:0:0:1")) == "2001:db8::1:0:0:1");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("2001:db8:0:1:1:1:1:1")) == "2001:db8:0:1:1:1:1:1");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("1:0:0:2:0:0:0:3")) == "1:0:0:2::3");
+    CHECK(format(CLArgs::parse_value<CLArgs::Ipv6Address>("::ffff:c000:0201")) == "::ffff:192.0.2.1");
+    CHECK(format(CLArgs::parse_value<CLArgs::Endpoint>("[2001:db8::1]:443")) == "[2001:db8::1]:443");
+    CHECK(format(CLArgs::parse_value<CLArgs::Endpoint>("127.0.0.1:0")) == "127.0.0.1:0");
+
+    const auto longest = CLArgs::parse_value<CLArgs::Endpoint>("[ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255]:65535");
+    CHECK(format(longest).size() <= CLArgs::max_network_value_length);
+}
+
+TEST_CASE("Network values are parsed in place by the parser", "[network]")
+{
+    using ListenOption = CLArgs::Option<"--listen", "<address:port>", "Specify the address to listen on", CLArgs::Endpoint>;
+    using PeerOption   = CLArgs::Option<"--peer", "<ip address>", "Specify the peer address", CLArgs::IpAddress>;
+
+    auto parser = CLArgs::ParserBuilder{}.add_option<ListenOption>().add_option<PeerOption>().build();
+
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--listen", "[::]:8443", "--peer", "10.1.2.3"}));
+    CHECK(parser.get_option<ListenOption>()->port == 8443);
+    CHECK(parser.get_option<ListenOption>()->address.is_v6());
+    CHECK(parser.get_option<PeerOption>() == CLArgs::IpAddress{CLArgs::Ipv4Address{{10, 1, 2, 3}}});
+
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--peer", "10.1.2"}), Catch::Matchers::ContainsSubstring("IP address"));
+}
+
+#ifdef CLARGS_HAS_SOCKADDR
+TEST_CASE("Endpoints convert to sockaddr", "[network]")
+{
+    sockaddr_storage storage{};
+
+    const auto v4 = CLArgs::parse_value<CLArgs::Endpoint>("192.0.2.1:8080");
+    REQUIRE(v4.to_sockaddr(storage) == sizeof(sockaddr_in));
+
+    sockaddr_in ipv4{};
+    std::memcpy(&ipv4, &storage, sizeof(ipv4));
+    CHECK(ipv4.sin_family == AF_INET);
+    CHECK(ntohs(ipv4.sin_port) == 8080);
+    CHECK(ntohl(ipv4.sin_addr.s_addr) == 0xC0000201);
+
+    const auto v6 = CLArgs::parse_value<CLArgs::Endpoint>("[2001:db8::1]:443");
+    REQUIRE(v6.to_sockaddr(storage) == sizeof(sockaddr_in6));
+
+    sockaddr_in6 ipv6{};
+    std::memcpy(&ipv6, &storage, sizeof(ipv6));
+    CHECK(ipv6.sin6_family == AF_INET6);
+    CHECK(ntohs(ipv6.sin6_port) == 443);
+    CHECK(std::memcmp(&ipv6.sin6_addr, v6.address.bytes.data(), 16) == 0);
+}
+#endif
+
+#if __has_include(<arpa/inet.h>)
+TEST_CASE("Address parsing agrees with inet_pton", "[network]")
+{
+    constexpr std::array ipv4_inputs{"0.0.0.0", "1.2.3.4", "255.255.255.255", "256.0.0.1", "1.2.3", "01.2.3.4", "1.2.3.4.", "a.b.c.d"};
+    for (const char *input : ipv4_inputs)
+    {
+        CLArgs::Ipv4Address address;
+        in_addr             expected{};
+        const bool          valid = inet_pton(AF_INET, input, &expected) == 1;
+
+        INFO(input);
+        REQUIRE(static_cast<bool>(CLArgs::parse_ipv4_address(input, address)) == valid);
+        if (valid)
+        {
+            CHECK(std::memcmp(&expected, address.bytes.data(), 4) == 0);
+        }
+    }
+
+    constexpr std::array ipv6_inputs{
+        "::", "::1", "1::", "1:2:3:4:5:6:7:8", "1:2:3:4:5:6:7::", "::2:3:4:5:6:7:8", "fe80::1:2", "::ffff:1.2.3.4", "1:2:3:4:5:6:1.2.3.4",
+        ":1", "1:", "1:::2", "1::2::3", "12345::", "1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7:1.2.3.4", "::1.2.3", "g::",
+    };
+    for (const char *input : ipv6_inputs)
+    {
+        CLArgs::Ipv6Address address;
+        in6_addr            expected{};
+        const bool          valid = inet_pton(AF_INET6, input, &expected) == 1;
+
+        INFO(input);
+        REQUIRE(static_cast<bool>(CLArgs::parse_ipv6_address(input, address)) == valid);
+        if (valid)
+        {
+            CHECK(std::memcmp(&expected, address.bytes.data(), 16) == 0);
+        }
+    }
+}
+
+TEST_CASE("Address parsing compared to inet_pton", "[network][!benchmark]")
+{
+    constexpr std::array ipv4_inputs{"192.0.2.1", "10.255.0.17", "172.16.254.3", "8.8.8.8"};
+    constexpr std::array ipv6_inputs{"2001:db8::ff00:42:8329", "::1", "fe80::1ff:fe23:4567:890a", "::ffff:192.0.2.1"};
+
+    BENCHMARK("parse_ipv4_address")
+    {
+        std::uint32_t sum = 0;
+        for (const char *input : ipv4_inputs)
+        {
+            CLArgs::Ipv4Address address;
+            (void)CLArgs::parse_ipv4_address(input, address);
+            sum += address.bytes[3];
+        }
+        return sum;
+    };
+
+    BENCHMARK("inet_pton, AF_INET")
+    {
+        std::uint32_t sum = 0;
+        for (const char *input : ipv4_inputs)
+        {
+            in_addr address{};
+            inet_pton(AF_INET, input, &address);
+            sum += address.s_addr;
+        }
+        return sum;
+    };
+
+    BENCHMARK("parse_ipv6_address")
+    {
+        std::uint32_t sum = 0;
+        for (const char *input : ipv6_inputs)
+        {
+            CLArgs::Ipv6Address address;
+            (void)CLArgs::parse_ipv6_address(input, address);
+            sum += address.bytes[15];
+        }
+        return sum;
+    };
+
+    BENCHMARK("inet_pton, AF_INET6")
+    {
+        std::uint32_t sum = 0;
+        for (const char *input : ipv6_inputs)
+        {
+            in6_addr address{};
+            inet_pton(AF_INET6, input, &address);
+            sum += address.s6_addr[15];
+        }
+        return sum;
+    };
+}
+#endif
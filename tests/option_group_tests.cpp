@@ -0,0 +1,95 @@
+#include <CLArgs/option_group.hpp>
+#include <CLArgs/parser_builder.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using SizeOption    = CLArgs::Option<"--size,-s", "<count>", "Connections in the pool", std::uint32_t, 8>;
+using TimeoutOption = CLArgs::Option<"--timeout", "<duration>", "Time to wait for a connection", std::chrono::milliseconds>;
+using HostOption    = CLArgs::Option<"--host,--hostname", "<host>", "Host to connect to", std::string>;
+using TtlOption     = CLArgs::Option<"--ttl", "<duration>", "Time to keep entries", std::chrono::seconds>;
+using EnabledFlag   = CLArgs::Flag<"--enabled", "Enable the subsystem">;
+using VerboseFlag   = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+
+using PoolGroup  = CLArgs::OptionGroup<"pool", SizeOption, TimeoutOption>;
+using DbGroup    = CLArgs::OptionGroup<"db", HostOption, PoolGroup, EnabledFlag>;
+using CacheGroup = CLArgs::OptionGroup<"cache.l2", TtlOption, SizeOption, EnabledFlag>;
+
+namespace
+{
+    // Stands in for a subsystem that only knows about its own group
+    std::string
+    describe_pool(const CLArgs::OptionGroupView<PoolGroup> &pool)
+    {
+        return std::to_string(pool.get<SizeOption>()) + (pool.get_option<TimeoutOption>() ? " with timeout" : "");
+    }
+} // namespace
+
+TEST_CASE("Group members get namespaced long identifiers", "[option_group]")
+{
+    using Size = CLArgs::Namespaced<"db.pool", SizeOption>;
+    using Host = CLArgs::Namespaced<"db", HostOption>;
+
+    STATIC_REQUIRE(Size::identifiers.size() == 1);
+    STATIC_REQUIRE(Size::identifiers[0] == "--db.pool.size");
+    STATIC_REQUIRE(Host::identifiers[0] == "--db.host");
+    STATIC_REQUIRE(Host::identifiers[1] == "--db.hostname");
+    STATIC_REQUIRE(Size::value_hint == SizeOption::value_hint);
+    STATIC_REQUIRE(CLArgs::CmdOptionWithDefault<Size>);
+    STATIC_REQUIRE(CLArgs::all_flags_v<CLArgs::Namespaced<"db", EnabledFlag>>);
+
+    using Parsables = DbGroup::ParsableList;
+    STATIC_REQUIRE(std::tuple_size_v<Parsables> == 4);
+    STATIC_REQUIRE(std::tuple_element_t<1, Parsables>::identifiers[0] == "--db.pool.size");
+    STATIC_REQUIRE(std::tuple_element_t<2, Parsables>::identifiers[0] == "--db.pool.timeout");
+    STATIC_REQUIRE(std::tuple_size_v<DbGroup::FlagList> == 1);
+    STATIC_REQUIRE(std::tuple_size_v<DbGroup::OptionList> == 3);
+
+    STATIC_REQUIRE(DbGroup::offset_of<HostOption>() == 0);
+    STATIC_REQUIRE(DbGroup::offset_of<PoolGroup>() == 1);
+    STATIC_REQUIRE(DbGroup::offset_of<EnabledFlag>() == 3);
+}
+
+TEST_CASE("Parser with option groups", "[option_group]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_flag<VerboseFlag>().add_group<DbGroup>().add_group<CacheGroup>().build();
+
+    const std::array args{"--db.hostname", "localhost", "--db.pool.size", "32", "--cache.l2.ttl", "60", "-v", "--db.enabled"};
+    REQUIRE_NOTHROW(parser.parse("program", args));
+
+    CHECK(parser.has_flag<VerboseFlag>());
+
+    const CLArgs::OptionGroupView<DbGroup> db = parser.group<DbGroup>();
+    CHECK(db.get_option<HostOption>() == "localhost");
+    CHECK(db.has_flag<EnabledFlag>());
+    CHECK(db.group<PoolGroup>().get<SizeOption>() == 32);
+    CHECK(describe_pool(db.group<PoolGroup>()) == "32");
+
+    // The same member types hold separate values in every group
+    const auto cache = parser.group<CacheGroup>();
+    CHECK(cache.get_option<TtlOption>() == std::chrono::seconds{60});
+    CHECK(cache.get<SizeOption>() == 8);
+    CHECK_FALSE(cache.has_flag<EnabledFlag>());
+
+    CHECK_THAT(parser.help(), Catch::Matchers::ContainsSubstring("--db.pool.timeout"));
+}
+
+TEST_CASE("Group members are matched by their full identifiers", "[option_group]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_group<DbGroup>().build();
+
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--size", "4"}), Catch::Matchers::ContainsSubstring("Unknown option"));
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"-s", "4"}), Catch::Matchers::ContainsSubstring("Unknown option"));
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--db.pool", "4"}), Catch::Matchers::ContainsSubstring("Unknown option"));
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--db.pool.size", "1", "--db.pool.size", "2"}),
+                      Catch::Matchers::ContainsSubstring("Duplicate argument \"--db.pool.size\""));
+
+    parser.allow_abbreviations();
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--db.pool.t", "250"}));
+    CHECK(parser.group<DbGroup>().group<PoolGroup>().get_option<TimeoutOption>() == std::chrono::milliseconds{250});
+}
@@ -5,6 +5,7 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
@@ -323,6 +324,7 @@ TEST_CASE("parse_value() can parse strings views", "[parse_value]")
     CHECK(CLArgs::parse_value<std::string_view>("Foo") == "Foo");
     CHECK(CLArgs::parse_value<std::string_view>("    Bar") == "    Bar");
     CHECK(CLArgs::parse_value<std::string_view>("Baz  ") == "Baz  ");
+    CHECK(CLArgs::parse_value<std::string_view>(std::string_view{"Hello world"}.substr(0, 5)) == "Hello");
 }
 
 TEST_CASE("parse_value() can parse filesystem paths", "[parse_value]")
@@ -409,3 +411,37 @@ TEMPLATE_TEST_CASE("parse_value() can parse std::chrono::duration types",
         CHECK_THROWS_AS(CLArgs::parse_value<TestType>("9999999999999999999999999999999999999999"), CLArgs::ParseValueException<TestType>);
     }
 }
+
+TEST_CASE("parse_value() can parse delimited lists into a std::array", "[parse_value]")
+{
+    using Ports = std::array<std::uint16_t, 3>;
+
+    CHECK(CLArgs::parse_value<Ports>("80,443,8080") == Ports{80, 443, 8080});
+    CHECK(CLArgs::parse_value<std::array<double, 3>>("0.1,0.2,0.7") == std::array{0.1, 0.2, 0.7});
+    CHECK(CLArgs::parse_value<std::array<std::string_view, 2>>("a,b") == std::array<std::string_view, 2>{"a", "b"});
+
+    CHECK_THROWS_AS(CLArgs::parse_value<Ports>(""), CLArgs::ParseValueException<Ports>);
+    CHECK_THROWS_WITH(CLArgs::parse_value<Ports>("80,443"), Catch::Matchers::EndsWith("Expected 3 elements, got 2"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Ports>("80,443,8080,1"), Catch::Matchers::EndsWith("Expected 3 elements, got 4"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Ports>("80,,8080"), Catch::Matchers::ContainsSubstring("Element 1: "));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Ports>("80,443,99999"), Catch::Matchers::ContainsSubstring("Element 2: "));
+}
+
+TEST_CASE("parse_value() can parse delimited lists into an InlineVector", "[parse_value]")
+{
+    using Weights = CLArgs::InlineVector<double, 4>;
+
+    const auto weights = CLArgs::parse_value<Weights>("0.1,0.2,0.7");
+    REQUIRE(weights.size() == 3);
+    CHECK(weights[0] == 0.1);
+    CHECK(weights[1] == 0.2);
+    CHECK(weights[2] == 0.7);
+
+    CHECK(CLArgs::parse_value<Weights>("1").size() == 1);
+    CHECK(CLArgs::parse_value<Weights>("1,2,3,4").size() == 4);
+
+    CHECK_THROWS_AS(CLArgs::parse_value<Weights>(""), CLArgs::ParseValueException<Weights>);
+    CHECK_THROWS_WITH(CLArgs::parse_value<Weights>("1,2,3,4,5"), Catch::Matchers::EndsWith("Expected at most 4 elements, got 5"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Weights>("1,x"), Catch::Matchers::ContainsSubstring("Element 1: "));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Weights>("1,"), Catch::Matchers::ContainsSubstring("Element 1: "));
+}
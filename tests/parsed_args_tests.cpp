@@ -0,0 +1,107 @@
+#include <CLArgs/parsed_args.hpp>
+#include <CLArgs/parser.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+using FlagList    = CLArgs::CmdFlagList<VerboseFlag>;
+
+using NameOption  = CLArgs::Option<"--name", "<name>", "Name to greet", std::string>;
+using LevelOption = CLArgs::Option<"--level", "<level>", "Level of detail", int, 3>;
+using OptionList  = CLArgs::CmdOptionList<NameOption, LevelOption>;
+
+using SnapshotParser = CLArgs::Parser<FlagList, OptionList, "Program description">;
+using Snapshot       = CLArgs::ParsedArgs<VerboseFlag, NameOption, LevelOption>;
+
+TEST_CASE("ParsedArgs is aligned to a cache line and movable", "[parsed_args]")
+{
+    STATIC_REQUIRE(alignof(Snapshot) == CLArgs::cache_line_size);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<Snapshot>);
+    STATIC_REQUIRE(std::is_copy_constructible_v<Snapshot>);
+}
+
+TEST_CASE("Snapshot holds the parsed values", "[parsed_args]")
+{
+    constexpr std::array args = {"program", "-v", "--name", "World"};
+    auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+    SnapshotParser parser;
+    REQUIRE_NOTHROW(parser.parse(argc, argv));
+
+    const Snapshot snapshot = parser.snapshot();
+
+    CHECK(snapshot.program() == "program");
+    CHECK(snapshot.has_flag<VerboseFlag>());
+    CHECK(snapshot.get_option<NameOption>() == "World");
+    CHECK(snapshot.get<LevelOption>() == 3);
+}
+
+TEST_CASE("Snapshot is independent of later parses", "[parsed_args]")
+{
+    SnapshotParser parser;
+
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--name", "first"}));
+    const Snapshot first = parser.snapshot();
+
+    REQUIRE_NOTHROW(parser.parse("other", std::array{"--level", "7"}));
+    const Snapshot second = parser.snapshot();
+
+    CHECK(first.program() == "program");
+    CHECK(first.get_option<NameOption>() == "first");
+    CHECK(first.get<LevelOption>() == 3);
+
+    CHECK(second.program() == "other");
+    CHECK_FALSE(second.get_option<NameOption>().has_value());
+    CHECK(second.get<LevelOption>() == 7);
+}
+
+TEST_CASE("Snapshot can be moved out of a temporary parser", "[parsed_args]")
+{
+    const auto snapshot = []
+    {
+        SnapshotParser parser;
+        parser.parse("program", std::array{"--name", "moved"});
+        return std::move(parser).snapshot();
+    }();
+
+    CHECK(snapshot.get_option<NameOption>() == "moved");
+}
+
+TEST_CASE("Snapshot can be shared between threads", "[parsed_args]")
+{
+    SnapshotParser parser;
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"-v", "--name", "shared", "--level", "5"}));
+
+    const auto snapshot = std::make_shared<const Snapshot>(parser.snapshot());
+    CHECK(reinterpret_cast<std::uintptr_t>(snapshot.get()) % CLArgs::cache_line_size == 0);
+
+    constexpr std::size_t          thread_count{4};
+    std::array<bool, thread_count> results{};
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back(
+                [snapshot, &result = results[i]]
+                {
+                    result = snapshot->has_flag<VerboseFlag>() && snapshot->get_option<NameOption>() == "shared" &&
+                             snapshot->get<LevelOption>() == 5;
+                });
+        }
+    }
+
+    for (const bool result : results)
+    {
+        CHECK(result);
+    }
+}
@@ -3,6 +3,15 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
 using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
 using FlagList    = CLArgs::CmdFlagList<VerboseFlag>;
 
@@ -23,3 +32,310 @@ TEST_CASE("Parse arguments", "[parse]")
     REQUIRE(file.has_value());
     REQUIRE(file.value() == "test.txt");
 }
+
+using HelpFlag              = CLArgs::Flag<"--help,-h", "Show help menu", CLArgs::FlagBehavior::Terminating>;
+using RetriesOption         = CLArgs::Option<"--retries", "<number>", "Specify retries", std::uint32_t>;
+using TerminatingFlagList   = CLArgs::CmdFlagList<VerboseFlag, HelpFlag>;
+using TerminatingOptionList = CLArgs::CmdOptionList<ConfigOption, RetriesOption>;
+
+TEST_CASE("Terminating flag stops parsing before any value is converted", "[parse]")
+{
+    STATIC_REQUIRE(CLArgs::TerminatingFlag<HelpFlag>);
+    STATIC_REQUIRE_FALSE(CLArgs::TerminatingFlag<VerboseFlag>);
+
+    CLArgs::Parser<TerminatingFlagList, TerminatingOptionList, "Program description"> parser;
+
+    SECTION("Invalid values and unknown options are ignored")
+    {
+        constexpr std::array args = {"program", "--retries", "not-a-number", "--unknown", "-v", "--help", "--config", "test.txt"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.has_flag<HelpFlag>());
+        CHECK_FALSE(parser.has_flag<VerboseFlag>());
+        CHECK_FALSE(parser.get_option<RetriesOption>().has_value());
+        CHECK_FALSE(parser.get_option<ConfigOption>().has_value());
+    }
+
+    SECTION("Terminating identifier passed as an option value is not a flag")
+    {
+        constexpr std::array args = {"program", "--config", "--help"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK_FALSE(parser.has_flag<HelpFlag>());
+        REQUIRE(parser.get_option<ConfigOption>().has_value());
+        CHECK(parser.get_option<ConfigOption>().value() == "--help");
+    }
+
+    SECTION("Without a terminating flag, errors are still reported")
+    {
+        constexpr std::array args = {"program", "--retries", "not-a-number", "-v"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        CHECK_THROWS_AS(parser.parse(argc, argv), std::invalid_argument);
+        CHECK_FALSE(parser.has_flag<HelpFlag>());
+    }
+}
+
+TEST_CASE("Arguments following \"--\" are passed through unparsed", "[parse]")
+{
+    CLArgs::Parser<TerminatingFlagList, TerminatingOptionList, "Program description"> parser;
+
+    SECTION("Passthrough is a view into argv")
+    {
+        std::array<const char *, 7> args = {"program", "-v", "--", "./worker", "--help", "--retries", nullptr};
+        auto [argc, argv]                = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc - 1, argv));
+        CHECK(parser.has_flag<VerboseFlag>());
+        CHECK_FALSE(parser.has_flag<HelpFlag>());
+        CHECK_FALSE(parser.get_option<RetriesOption>().has_value());
+
+        const auto passthrough = parser.passthrough();
+        REQUIRE(passthrough.size() == 3);
+        CHECK(passthrough.data() == argv + 3);
+        CHECK(std::string_view{passthrough[0]} == "./worker");
+        CHECK(passthrough.data()[passthrough.size()] == nullptr);
+    }
+
+    SECTION("Passthrough is empty when there is nothing after \"--\"")
+    {
+        constexpr std::array args = {"program", "--config", "test.txt", "--"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.get_option<ConfigOption>().has_value());
+        CHECK(parser.passthrough().empty());
+    }
+
+    SECTION("\"--\" can be the value of an option")
+    {
+        constexpr std::array args = {"program", "--config", "--", "-v"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        CHECK(parser.get_option<ConfigOption>().value() == "--");
+        CHECK(parser.has_flag<VerboseFlag>());
+        CHECK(parser.passthrough().empty());
+    }
+}
+
+TEST_CASE("Parse arguments from a range of string-like tokens", "[parse]")
+{
+    CLArgs::Parser<TerminatingFlagList, TerminatingOptionList, "Program description"> parser;
+
+    SECTION("std::vector<std::string_view>")
+    {
+        const std::string             buffer = "-v --config test.txt";
+        std::vector<std::string_view> tokens = {std::string_view{buffer}.substr(0, 2),
+                                                std::string_view{buffer}.substr(3, 8),
+                                                std::string_view{buffer}.substr(12)};
+
+        REQUIRE_NOTHROW(parser.parse("program", tokens));
+        CHECK(parser.program() == "program");
+        CHECK(parser.has_flag<VerboseFlag>());
+        REQUIRE(parser.get_option<ConfigOption>().has_value());
+        CHECK(parser.get_option<ConfigOption>().value() == "test.txt");
+    }
+
+    SECTION("std::span<const std::string> with passthrough")
+    {
+        const std::vector<std::string> tokens = {"--retries", "3", "--", "child", "-v"};
+
+        const auto passthrough = parser.parse("program", std::span<const std::string>{tokens});
+        CHECK(parser.get_option<RetriesOption>().value() == 3);
+        CHECK_FALSE(parser.has_flag<VerboseFlag>());
+        REQUIRE(std::ranges::distance(passthrough) == 2);
+        CHECK(passthrough.front() == "child");
+        CHECK(parser.passthrough().empty());
+    }
+
+    SECTION("Errors are reported like for argv")
+    {
+        const std::array<std::string_view, 2> tokens = {"--retries", "many"};
+        CHECK_THROWS_AS(parser.parse("program", tokens), std::invalid_argument);
+    }
+}
+
+using TimeoutOption  = CLArgs::Option<"--timeout", "<seconds>", "Specify timeout", std::chrono::seconds, 30>;
+using HostOption     = CLArgs::Option<"--host", "<host>", "Specify host", std::string, "localhost">;
+using DefaultOptions = CLArgs::CmdOptionList<TimeoutOption, HostOption, RetriesOption>;
+
+TEST_CASE("Options with a compile-time default", "[parse]")
+{
+    CLArgs::Parser<FlagList, DefaultOptions, "Program description"> parser;
+
+    SECTION("Defaults are used when the option is not passed")
+    {
+        constexpr std::array args = {"program", "--host", "example.com"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        REQUIRE_NOTHROW(parser.parse(argc, argv));
+        STATIC_REQUIRE(std::is_same_v<decltype(parser.get<TimeoutOption>()), const std::chrono::seconds &>);
+        CHECK(parser.get<TimeoutOption>() == std::chrono::seconds{30});
+        CHECK(parser.get<HostOption>() == "example.com");
+        CHECK(parser.get_option<TimeoutOption>().value() == std::chrono::seconds{30});
+        CHECK_FALSE(parser.get_option<RetriesOption>().has_value());
+    }
+
+    SECTION("Passing an option with a default twice is still a duplicate")
+    {
+        constexpr std::array args = {"program", "--timeout", "5", "--timeout", "10"};
+        auto [argc, argv]         = CLArgs::Testing::create_argc_argv_from_array(args);
+
+        CHECK_THROWS_AS(parser.parse(argc, argv), std::invalid_argument);
+    }
+
+    SECTION("Help shows the default value")
+    {
+        const std::string help = parser.help();
+        CHECK(help.find("Specify timeout (default: 30)") != std::string::npos);
+        CHECK(help.find("Specify host (default: localhost)") != std::string::npos);
+        CHECK(help.find("Specify retries\n") != std::string::npos);
+    }
+}
+
+TEST_CASE("Parsing again replaces previously parsed values", "[parse]")
+{
+    CLArgs::Parser<FlagList, OptionList, "Program description"> parser;
+
+    REQUIRE_NOTHROW(parser.parse_command_line("program", "-v --config first.txt"));
+    REQUIRE_NOTHROW(parser.parse_command_line("program", "--config second.txt"));
+
+    CHECK_FALSE(parser.has_flag<VerboseFlag>());
+    CHECK(parser.get_option<ConfigOption>().value() == "second.txt");
+}
+
+TEST_CASE("Push-style parsing", "[parse][push]")
+{
+    CLArgs::Parser<TerminatingFlagList, TerminatingOptionList, "Program description"> parser;
+
+    SECTION("Tokens are parsed as they are fed")
+    {
+        parser.begin("program");
+        CHECK(parser.feed("-v") == CLArgs::FeedResult::Consumed);
+        CHECK(parser.has_flag<VerboseFlag>());
+
+        // The value arrives in a separate call and the option token is gone by then
+        std::string token = "--retries";
+        CHECK(parser.feed(token) == CLArgs::FeedResult::Consumed);
+        token = "3";
+        CHECK(parser.feed(token) == CLArgs::FeedResult::Consumed);
+        CHECK(parser.get_option<RetriesOption>() == 3U);
+
+        REQUIRE_NOTHROW(parser.finish());
+        CHECK(parser.program() == "program");
+    }
+
+    SECTION("Tokens after -- are passed through")
+    {
+        parser.begin("program");
+        CHECK(parser.feed("--") == CLArgs::FeedResult::Consumed);
+        CHECK(parser.feed("-v") == CLArgs::FeedResult::Passthrough);
+        REQUIRE_NOTHROW(parser.finish());
+        CHECK_FALSE(parser.has_flag<VerboseFlag>());
+    }
+
+    SECTION("Tokens after a terminating flag are ignored")
+    {
+        parser.begin("program");
+        CHECK(parser.feed("--help") == CLArgs::FeedResult::Consumed);
+        CHECK(parser.feed("--unknown") == CLArgs::FeedResult::Ignored);
+        REQUIRE_NOTHROW(parser.finish());
+        CHECK(parser.has_flag<HelpFlag>());
+    }
+
+    SECTION("Missing option value is reported by finish()")
+    {
+        parser.begin("program");
+        CHECK(parser.feed("--config") == CLArgs::FeedResult::Consumed);
+        CHECK_THROWS_AS(parser.finish(), std::invalid_argument);
+    }
+
+    SECTION("Errors are reported by feed()")
+    {
+        parser.begin("program");
+        CHECK_THROWS_AS(parser.feed("--unknown"), std::invalid_argument);
+
+        parser.feed("--retries");
+        CHECK_THROWS_AS(parser.feed("many"), std::invalid_argument);
+
+        // A failed value does not leave the parser waiting for another one
+        CHECK(parser.feed("-v") == CLArgs::FeedResult::Consumed);
+        CHECK_THROWS_AS(parser.feed("-v"), std::invalid_argument);
+    }
+
+    SECTION("Feeding requires begin()")
+    {
+        CHECK_THROWS_AS(parser.feed("-v"), std::logic_error);
+        CHECK_THROWS_AS(parser.finish(), std::logic_error);
+    }
+
+    SECTION("begin() discards previous values")
+    {
+        parser.begin("program");
+        parser.feed("-v");
+        parser.finish();
+
+        parser.begin("program");
+        parser.finish();
+        CHECK_FALSE(parser.has_flag<VerboseFlag>());
+    }
+}
+
+TEST_CASE("Abbreviated long options", "[parse][abbreviations]")
+{
+    using VersionFlag = CLArgs::Flag<"--version", "Show version", CLArgs::FlagBehavior::Terminating>;
+
+    CLArgs::Parser<CLArgs::CmdFlagList<VerboseFlag, VersionFlag>, OptionList, "Program description"> parser;
+
+    SECTION("Abbreviations are rejected unless allowed")
+    {
+        CHECK_THROWS_AS(parser.parse_command_line("program", "--verb"), std::invalid_argument);
+    }
+
+    parser.allow_abbreviations();
+
+    SECTION("Unique prefixes are expanded")
+    {
+        REQUIRE_NOTHROW(parser.parse_command_line("program", "--verb --conf test.txt"));
+        CHECK(parser.has_flag<VerboseFlag>());
+        CHECK(parser.get_option<ConfigOption>().value() == "test.txt");
+    }
+
+    SECTION("Ambiguous prefixes are reported with their candidates")
+    {
+        try
+        {
+            parser.parse_command_line("program", "--ver");
+            FAIL("Expected an exception");
+        }
+        catch (const std::invalid_argument &e)
+        {
+            CHECK(std::string_view{e.what()} == "Ambiguous option \"--ver\", could be --verbose, --version");
+        }
+    }
+
+    SECTION("Abbreviated terminating flags are found before other arguments")
+    {
+        REQUIRE_NOTHROW(parser.parse_command_line("program", "--unknown --vers"));
+        CHECK(parser.has_flag<VersionFlag>());
+    }
+
+    SECTION("Abbreviations work when pushing tokens")
+    {
+        parser.begin("program");
+        parser.feed("--configuration");
+        parser.feed("test.txt");
+        parser.feed("--verbo");
+        REQUIRE_NOTHROW(parser.finish());
+        CHECK(parser.has_flag<VerboseFlag>());
+        CHECK(parser.get_option<ConfigOption>().value() == "test.txt");
+    }
+
+    SECTION("Duplicates are detected across abbreviations")
+    {
+        CHECK_THROWS_AS(parser.parse_command_line("program", "--verbose --verb"), std::invalid_argument);
+    }
+}
@@ -0,0 +1,135 @@
+#include <CLArgs/common_options.hpp>
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/quantity.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Unit conversion factors are reduced", "[quantity]")
+{
+    CLArgs::UnitSuffix factor;
+
+    REQUIRE(CLArgs::unit_conversion_factor({"h", 3'600, 1}, {"ms", 1, 1'000}, factor));
+    CHECK(factor.numerator == 3'600'000);
+    CHECK(factor.denominator == 1);
+
+    REQUIRE(CLArgs::unit_conversion_factor({"ms", 1, 1'000}, {"s", 1, 1}, factor));
+    CHECK(factor.numerator == 1);
+    CHECK(factor.denominator == 1'000);
+
+    REQUIRE(CLArgs::unit_conversion_factor({"w", 604'800, 1}, {"ns", 1, 1'000'000'000}, factor));
+    CHECK(factor.numerator == 604'800'000'000'000);
+    CHECK(factor.denominator == 1);
+
+    STATIC_REQUIRE(CLArgs::find_unit_suffix(CLArgs::byte_size_suffixes, "MiB")->numerator == 1024 * 1024);
+    STATIC_REQUIRE(CLArgs::find_unit_suffix(CLArgs::duration_suffixes, "mib") == nullptr);
+}
+
+TEST_CASE("Durations accept unit suffixes", "[quantity]")
+{
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("250") == 250ms);
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("250ms") == 250ms);
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("2s") == 2'000ms);
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("1h30m") == 90min);
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("1m30s500ms") == 90'500ms);
+    CHECK(CLArgs::parse_value<std::chrono::milliseconds>("-1m30s") == -90s);
+    CHECK(CLArgs::parse_value<std::chrono::microseconds>("3µs") == 3us);
+    CHECK(CLArgs::parse_value<std::chrono::seconds>("1w1d") == std::chrono::days{8});
+    CHECK(CLArgs::parse_value<std::chrono::minutes>("2h") == 120min);
+    CHECK(CLArgs::parse_value<std::chrono::nanoseconds>("-9223372036854775808ns") == std::chrono::nanoseconds::min());
+    CHECK(CLArgs::parse_value<std::chrono::duration<double>>("250ms") == 0.25s);
+    CHECK(CLArgs::parse_value<std::chrono::duration<double>>("1.5m") == 90s);
+}
+
+TEST_CASE("Durations reject invalid quantities", "[quantity]")
+{
+    using Milliseconds = std::chrono::milliseconds;
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("1500us"), Catch::Matchers::EndsWith("Not a whole number of milliseconds"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("1h30"), Catch::Matchers::EndsWith("Missing unit after the last number"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("10parsecs"), Catch::Matchers::EndsWith("Unknown unit \"parsecs\""));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("1.5s"), Catch::Matchers::EndsWith("Invalid character at '.'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("100000000000000000d"), Catch::Matchers::EndsWith("Number out of range"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("9223372036854775807ms1ms"), Catch::Matchers::EndsWith("Number out of range"));
+    CHECK_THROWS_AS(CLArgs::parse_value<Milliseconds>("ms"), CLArgs::ParseValueException<Milliseconds>);
+    CHECK_THROWS_AS(CLArgs::parse_value<Milliseconds>("-"), CLArgs::ParseValueException<Milliseconds>);
+    CHECK_THROWS_AS(CLArgs::parse_value<Milliseconds>("1 s"), CLArgs::ParseValueException<Milliseconds>);
+
+    // Only the whole value takes a sign, not the numbers in it
+    using Seconds = std::chrono::duration<double>;
+    CHECK_THROWS_WITH(CLArgs::parse_value<Seconds>("1h-30m"), Catch::Matchers::EndsWith("Invalid character at '-'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Seconds>("1h+30m"), Catch::Matchers::EndsWith("Invalid character at '+'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Seconds>("--5"), Catch::Matchers::EndsWith("Invalid character at '-'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Seconds>("-+5"), Catch::Matchers::EndsWith("Invalid character at '+'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("1h-30m"), Catch::Matchers::EndsWith("Invalid character at '-'"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<Milliseconds>("--5"), Catch::Matchers::EndsWith("Invalid character at '-'"));
+    CHECK(CLArgs::parse_value<Seconds>("-1m30s") == -90s);
+
+    using UnsignedSeconds = std::chrono::duration<std::uint32_t>;
+    CHECK_THROWS_AS(CLArgs::parse_value<UnsignedSeconds>("-1s"), CLArgs::ParseValueException<UnsignedSeconds>);
+}
+
+TEST_CASE("Byte sizes accept SI and IEC suffixes", "[quantity]")
+{
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("4096").bytes == 4096);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("512B").bytes == 512);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("2G").bytes == 2'000'000'000);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("2GB").bytes == 2'000'000'000);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("64MiB").bytes == 64 * 1024 * 1024);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("1Gi512Mi").bytes == 1536 * 1024 * 1024);
+    CHECK(CLArgs::parse_value<CLArgs::ByteSize>("15EiB").bytes == 15 * (std::uint64_t{1} << 60));
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ByteSize>("16EiB"), Catch::Matchers::EndsWith("Number out of range"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ByteSize>("64mb"), Catch::Matchers::EndsWith("Unknown unit \"mb\""));
+    CHECK_THROWS_AS(CLArgs::parse_value<CLArgs::ByteSize>("-1MiB"), CLArgs::ParseValueException<CLArgs::ByteSize>);
+    CHECK_THROWS_AS(CLArgs::parse_value<CLArgs::ByteSize>(""), CLArgs::ParseValueException<CLArgs::ByteSize>);
+}
+
+TEST_CASE("Rates take a count and a period", "[quantity]")
+{
+    const auto rate = CLArgs::parse_value<CLArgs::Rate>("10k/s");
+    CHECK(rate.count == 10'000);
+    CHECK(rate.period() == 1s);
+    CHECK(rate.per_second() == 10'000.0);
+
+    CHECK(CLArgs::parse_value<CLArgs::Rate>("500/min") == CLArgs::Rate{500, 60'000'000'000});
+    CHECK(CLArgs::parse_value<CLArgs::Rate>("20/100ms") == CLArgs::Rate{20, 100'000'000});
+    CHECK(CLArgs::parse_value<CLArgs::Rate>("20/100ms").per_second() == 200.0);
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Rate>("100"), Catch::Matchers::EndsWith("Missing \"/\" and period"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Rate>("100/"), Catch::Matchers::EndsWith("Missing unit of the period"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Rate>("100/10"), Catch::Matchers::EndsWith("Missing unit of the period"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Rate>("100/0s"), Catch::Matchers::EndsWith("Period cannot be zero"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::Rate>("10x/s"), Catch::Matchers::EndsWith("Unknown unit \"x\""));
+}
+
+TEST_CASE("Quantities round-trip through format_value", "[quantity]")
+{
+    const auto round_trip = []<typename T>(const T &value)
+    {
+        std::string formatted(CLArgs::format_value(value, nullptr), '\0');
+        CLArgs::format_value(value, formatted.data());
+        return CLArgs::parse_value<T>(formatted);
+    };
+
+    CHECK(round_trip(CLArgs::ByteSize{64 * 1024}) == CLArgs::ByteSize{64 * 1024});
+    CHECK(round_trip(CLArgs::Rate{10, 1'000'000'000}) == CLArgs::Rate{10, 1'000'000'000});
+}
+
+TEST_CASE("CommonOptions::Timeout accepts units", "[quantity]")
+{
+    using Timeout = CLArgs::CommonOptions::Timeout::ValueType;
+
+    CHECK(CLArgs::parse_value<Timeout>("10") == 10s);
+    CHECK(CLArgs::parse_value<Timeout>("250ms") == 250ms);
+    CHECK(CLArgs::parse_value<Timeout>("1m30s") == 90s);
+    CHECK_THROWS_AS(CLArgs::parse_value<Timeout>("1h-30m"), CLArgs::ParseValueException<Timeout>);
+    CHECK_THROWS_AS(CLArgs::parse_value<Timeout>("--5"), CLArgs::ParseValueException<Timeout>);
+}
@@ -0,0 +1,154 @@
+#include <CLArgs/common_options.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/reloadable.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using LevelOption = CLArgs::Option<"--level", "LEVEL", "Level of detail", int, 0>;
+    using NameOption  = CLArgs::Option<"--name", "NAME", "Name of the service", std::string>;
+
+    using ParserType = decltype(CLArgs::ParserBuilder{}
+                                    .add_option<CLArgs::CommonOptions::Config>()
+                                    .add_option<LevelOption>()
+                                    .add_option<NameOption>()
+                                    .build());
+
+    using Config = CLArgs::Reloadable<ParserType>;
+
+    using LabelOption = CLArgs::Option<"--label", "LABEL", "Label of the service", std::string_view>;
+    using ViewConfig  = CLArgs::Reloadable<decltype(CLArgs::ParserBuilder{}.add_option<LabelOption>().build())>;
+} // namespace
+
+TEST_CASE("Reloadable starts with the defaults", "[reloadable]")
+{
+    const Config config;
+
+    REQUIRE(config.version() == 0);
+    REQUIRE(config.load()->get<LevelOption>() == 0);
+    REQUIRE_FALSE(config.load()->get_option<NameOption>().has_value());
+}
+
+TEST_CASE("Reloadable publishes a new snapshot on reload", "[reloadable]")
+{
+    Config config;
+    auto   reader = config.reader();
+
+    const auto before = config.load();
+
+    config.reload("service", std::array{"--config", "/etc/service.conf", "--level", "2"});
+
+    REQUIRE(config.version() == 1);
+    REQUIRE(reader.get().get<LevelOption>() == 2);
+    REQUIRE(reader.get().get_option<CLArgs::CommonOptions::Config>() == std::filesystem::path{"/etc/service.conf"});
+
+    // Snapshots handed out earlier remain valid and unchanged
+    REQUIRE(before->get<LevelOption>() == 0);
+
+    config.reload_command_line("service", "--name 'control socket' --level 3");
+
+    REQUIRE(config.version() == 2);
+    REQUIRE(reader.get().get<LevelOption>() == 3);
+    REQUIRE(reader.get().get_option<NameOption>() == "control socket");
+}
+
+TEST_CASE("Reloadable keeps the current snapshot when a reload fails", "[reloadable]")
+{
+    Config config;
+    config.reload("service", std::array{"--level", "4"});
+
+    SECTION("Parse error")
+    {
+        REQUIRE_THROWS_AS(config.reload("service", std::array{"--level", "four"}), std::invalid_argument);
+    }
+
+    SECTION("Validation error")
+    {
+        const auto validate = [](const Config::Snapshot &snapshot)
+        {
+            if (snapshot.get<LevelOption>() > 9)
+            {
+                throw std::invalid_argument("Level out of range");
+            }
+        };
+        REQUIRE_THROWS_AS(config.reload_command_line("service", "--level 10", validate), std::invalid_argument);
+    }
+
+    REQUIRE(config.version() == 1);
+    REQUIRE(config.load()->get<LevelOption>() == 4);
+}
+
+TEST_CASE("Reloadable keeps the storage of string views alive", "[reloadable]")
+{
+    ViewConfig config;
+
+    config.reload_command_line("service", "--label 'a label that does not fit into the small string buffer'");
+    const auto from_command_line = config.load();
+
+    {
+        std::vector<std::string> args{"--label", "another label that does not fit into the small string buffer"};
+        config.reload("service", args);
+    }
+    const auto from_args = config.load();
+
+    // Both the parsers and the arguments are gone, the snapshots are not
+    CHECK(from_command_line->get_option<LabelOption>() == "a label that does not fit into the small string buffer");
+    CHECK(from_args->get_option<LabelOption>() == "another label that does not fit into the small string buffer");
+}
+
+TEST_CASE("Reloadable can be read from many threads during reloads", "[reloadable]")
+{
+    Config config;
+
+    constexpr std::size_t reader_count{8};
+    constexpr int         reload_count{500};
+
+    std::atomic<bool>        done{false};
+    std::atomic<std::size_t> inconsistent{0};
+    {
+        std::vector<std::jthread> readers;
+        for (std::size_t i = 0; i < reader_count; ++i)
+        {
+            readers.emplace_back(
+                [&]
+                {
+                    auto reader = config.reader();
+                    int  last   = 0;
+                    while (!done.load(std::memory_order_relaxed))
+                    {
+                        // Every snapshot is published as a whole and levels only grow
+                        const auto &snapshot = reader.get();
+                        const int   level    = snapshot.get<LevelOption>();
+                        const auto &name     = snapshot.get_option<NameOption>();
+                        if (level < last || (level > 0 && name != std::to_string(level)))
+                        {
+                            inconsistent.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        last = level;
+                    }
+                });
+        }
+
+        for (int level = 1; level <= reload_count; ++level)
+        {
+            const std::string value = std::to_string(level);
+            config.reload("service", std::array{"--level", value.c_str(), "--name", value.c_str()});
+        }
+        done.store(true, std::memory_order_relaxed);
+    }
+
+    REQUIRE(inconsistent.load() == 0);
+    REQUIRE(config.version() == reload_count);
+    REQUIRE(config.load()->get<LevelOption>() == reload_count);
+}
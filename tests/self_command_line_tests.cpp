@@ -0,0 +1,160 @@
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/self_command_line.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(__linux__)
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+#if defined(__linux__)
+namespace
+{
+    constexpr const char *parse_self_probe_variable = "CLARGS_PARSE_SELF_PROBE=1";
+    constexpr int         parse_self_probe_passed{0};
+    constexpr int         parse_self_probe_failed{1};
+    constexpr int         parse_self_probe_threw{2};
+
+    using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+    using NameOption  = CLArgs::Option<"--name", "<name>", "Name to greet", std::string>;
+
+    // Runs before main() when the test binary is started by the parse_self()
+    // test, so Catch2 never sees the arguments, and exits with the result
+    [[maybe_unused]] const bool parse_self_probe = []
+    {
+        if (std::getenv("CLARGS_PARSE_SELF_PROBE") == nullptr)
+        {
+            return false;
+        }
+
+        auto parser = CLArgs::ParserBuilder{}.add_flag<VerboseFlag>().add_option<NameOption>().build();
+        try
+        {
+            const std::span<const std::string_view> passthrough = parser.parse_self();
+            const std::span<const std::string_view> arguments   = CLArgs::self_command_line();
+
+            // Neither the program name nor the passthrough arguments are
+            // copied out of the cached command line
+            const bool passed = parser.program() == "program" && parser.program().data() == arguments.front().data() &&
+                                parser.has_flag<VerboseFlag>() && parser.get_option<NameOption>() == "a b" &&
+                                passthrough.size() == 1 && passthrough.front() == "rest" && passthrough.data() == arguments.data() + 5;
+            std::_Exit(passed ? parse_self_probe_passed : parse_self_probe_failed);
+        }
+        catch (...)
+        {
+            std::_Exit(parse_self_probe_threw);
+        }
+    }();
+} // namespace
+#endif
+
+TEST_CASE("split_nul_separated() splits a /proc cmdline", "[self_command_line]")
+{
+    using Arguments = std::vector<std::string_view>;
+
+    CHECK(CLArgs::split_nul_separated("program\0-v\0--name\0a b\0"sv) == Arguments{"program", "-v", "--name", "a b"});
+    CHECK(CLArgs::split_nul_separated("program\0\0--\0"sv) == Arguments{"program", "", "--"});
+    CHECK(CLArgs::split_nul_separated("program"sv) == Arguments{"program"});
+    CHECK(CLArgs::split_nul_separated(""sv).empty());
+    CHECK(CLArgs::split_nul_separated("\0"sv) == Arguments{});
+
+    // Arguments are views into the contents
+    constexpr std::string_view contents{"program\0--verbose\0"sv};
+    CHECK(CLArgs::split_nul_separated(contents)[1].data() == contents.data() + 8);
+}
+
+TEST_CASE("read_proc_file() reads files larger than its initial buffer", "[self_command_line]")
+{
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / ("clargs_cmdline_" + std::to_string(std::random_device{}()));
+
+    std::string contents;
+    for (int i = 0; contents.size() < 10000; ++i)
+    {
+        contents += "--argument-" + std::to_string(i);
+        contents += '\0';
+    }
+    std::ofstream{path, std::ios::binary} << contents;
+
+    CHECK(CLArgs::read_proc_file(path) == contents);
+
+    std::filesystem::remove(path);
+    CHECK_THROWS_AS((void)CLArgs::read_proc_file(path), std::runtime_error);
+}
+
+TEST_CASE("read_command_line() reads the file again on every call", "[self_command_line]")
+{
+    using Arguments = std::vector<std::string>;
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / ("clargs_cmdline_" + std::to_string(std::random_device{}()));
+
+    std::ofstream{path, std::ios::binary} << "program\0-v\0a b\0"sv;
+    CHECK(CLArgs::read_command_line(path) == Arguments{"program", "-v", "a b"});
+
+    std::ofstream{path, std::ios::binary} << "other\0"sv;
+    CHECK(CLArgs::read_command_line(path) == Arguments{"other"});
+
+    std::filesystem::remove(path);
+    CHECK_THROWS_AS((void)CLArgs::read_command_line(path), std::runtime_error);
+}
+
+#if defined(__linux__)
+TEST_CASE("self_command_line() reads the command line of the process once", "[self_command_line]")
+{
+    const std::span<const std::string_view> arguments = CLArgs::self_command_line();
+
+    REQUIRE_FALSE(arguments.empty());
+    CHECK_FALSE(arguments.front().empty());
+
+    const std::span<const std::string_view> again = CLArgs::self_command_line();
+    CHECK(again.data() == arguments.data());
+    CHECK(again.size() == arguments.size());
+
+    const std::vector<std::string> read = CLArgs::read_command_line(CLArgs::default_proc_cmdline);
+    CHECK(std::ranges::equal(read, arguments));
+}
+
+TEST_CASE("parse_self() parses the command line of the process", "[self_command_line]")
+{
+    // The test binary runs itself with a known command line, see parse_self_probe
+    std::array<char *, 7> argv{const_cast<char *>("program"),
+                               const_cast<char *>("-v"),
+                               const_cast<char *>("--name"),
+                               const_cast<char *>("a b"),
+                               const_cast<char *>("--"),
+                               const_cast<char *>("rest"),
+                               nullptr};
+
+    std::vector<char *> environment{const_cast<char *>(parse_self_probe_variable)};
+    for (char **variable = environ; *variable != nullptr; ++variable)
+    {
+        environment.push_back(*variable);
+    }
+    environment.push_back(nullptr);
+
+    pid_t pid{};
+    REQUIRE(posix_spawn(&pid, "/proc/self/exe", nullptr, nullptr, argv.data(), environment.data()) == 0);
+
+    int status{};
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFEXITED(status));
+    CHECK(WEXITSTATUS(status) == parse_self_probe_passed);
+}
+#endif
@@ -0,0 +1,199 @@
+#include <CLArgs/parser.hpp>
+#include <CLArgs/suggestions.hpp>
+#include "test_utils.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Straightforward dynamic programming version to check the bit-parallel one against
+    std::size_t
+    reference_distance(const std::string_view a, const std::string_view b)
+    {
+        std::vector<std::vector<std::size_t>> d(a.size() + 1, std::vector<std::size_t>(b.size() + 1));
+        for (std::size_t i = 0; i <= a.size(); ++i)
+        {
+            d[i][0] = i;
+        }
+        for (std::size_t j = 0; j <= b.size(); ++j)
+        {
+            d[0][j] = j;
+        }
+
+        for (std::size_t i = 1; i <= a.size(); ++i)
+        {
+            for (std::size_t j = 1; j <= b.size(); ++j)
+            {
+                const std::size_t cost = a[i - 1] == b[j - 1] ? 0 : 1;
+                d[i][j]                = std::min({d[i - 1][j] + 1, d[i][j - 1] + 1, d[i - 1][j - 1] + cost});
+                if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                {
+                    d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+                }
+            }
+        }
+        return d[a.size()][b.size()];
+    }
+
+    template <std::size_t N>
+    std::array<std::string, N>
+    make_identifiers()
+    {
+        std::array<std::string, N> identifiers;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            identifiers[i] = "--option-" + std::to_string(i) + "-" + CLArgs::Testing::generate_random_string<4, 12>();
+        }
+        std::ranges::sort(identifiers);
+        return identifiers;
+    }
+} // namespace
+
+TEST_CASE("Damerau distance", "[suggestions]")
+{
+    CHECK(CLArgs::damerau_distance("--verbose", "--verbose") == 0);
+    CHECK(CLArgs::damerau_distance("--verbos", "--verbose") == 1);
+    CHECK(CLArgs::damerau_distance("--vrebose", "--verbose") == 1);
+    CHECK(CLArgs::damerau_distance("--verbsoe", "--verbose") == 1);
+    CHECK(CLArgs::damerau_distance("--vebrose", "--verbose") == 1);
+    CHECK(CLArgs::damerau_distance("--cnofig", "--config") == 1);
+    CHECK(CLArgs::damerau_distance("--conifg", "--config") == 1);
+    CHECK(CLArgs::damerau_distance("", "--config") == 8);
+    CHECK(CLArgs::damerau_distance("-x", "") == 2);
+}
+
+TEST_CASE("Damerau distance matches the reference implementation", "[suggestions]")
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        const std::string a = CLArgs::Testing::generate_random_string<1, 64>().substr(0, 2 + static_cast<std::size_t>(i) % 20);
+        std::string       b = a;
+
+        // Apply a few random edits, so distances are small like real typos
+        for (int edit = 0; edit < i % 4; ++edit)
+        {
+            const std::size_t position = static_cast<std::size_t>(i * 7 + edit * 3) % b.size();
+            switch ((i + edit) % 4)
+            {
+            case 0:
+                b.erase(position, 1);
+                break;
+            case 1:
+                b.insert(position, 1, 'x');
+                break;
+            case 2:
+                b[position] = 'y';
+                break;
+            default:
+                if (position + 1 < b.size())
+                {
+                    std::swap(b[position], b[position + 1]);
+                }
+                break;
+            }
+            if (b.empty())
+            {
+                b = "z";
+            }
+        }
+
+        INFO(a << " / " << b);
+        REQUIRE(CLArgs::damerau_distance(a, b) == reference_distance(a, b));
+    }
+}
+
+TEST_CASE("Closest identifier", "[suggestions]")
+{
+    constexpr std::array<std::string_view, 4> identifiers{"--config", "--configuration", "--verbose", "--version"};
+
+    CHECK(CLArgs::closest_identifier(identifiers, "--verbos") == "--verbose");
+    CHECK(CLArgs::closest_identifier(identifiers, "--verison") == "--version");
+    CHECK(CLArgs::closest_identifier(identifiers, "--confg") == "--config");
+    CHECK(CLArgs::closest_identifier(identifiers, "--cfg").empty());
+    CHECK(CLArgs::closest_identifier(identifiers, "--something-else").empty());
+    CHECK(CLArgs::closest_identifier(identifiers, std::string(100, 'a')).empty());
+}
+
+TEST_CASE("Unknown options suggest the closest identifier", "[suggestions]")
+{
+    using VerboseFlag  = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+    using ConfigOption = CLArgs::Option<"--config,-c", "<filepath>", "Specify config file", std::string>;
+
+    CLArgs::Parser<CLArgs::CmdFlagList<VerboseFlag>, CLArgs::CmdOptionList<ConfigOption>, "Program description"> parser;
+
+    try
+    {
+        parser.parse_command_line("program", "--vrebose");
+        FAIL("Expected an exception");
+    }
+    catch (const CLArgs::UnknownOptionException &e)
+    {
+        CHECK(e.argument() == "--vrebose");
+        CHECK(std::string_view{e.what()} == "Unknown option \"--vrebose\", did you mean \"--verbose\"?");
+    }
+
+    try
+    {
+        parser.parse_command_line("program", "--unrelated");
+        FAIL("Expected an exception");
+    }
+    catch (const std::invalid_argument &e)
+    {
+        CHECK(std::string_view{e.what()} == "Unknown option \"--unrelated\"");
+    }
+}
+
+TEST_CASE("Unknown option suggestion is searched for when the message is read", "[suggestions]")
+{
+    std::vector<std::string_view> identifiers{"--verbose", "--version"};
+
+    const CLArgs::UnknownOptionException exception{"--confg", identifiers};
+    const CLArgs::UnknownOptionException copy{exception};
+
+    // Had the search run in the constructor, it would not see this change
+    identifiers[1] = "--config";
+
+    std::array<std::string_view, 4> messages{};
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t i = 0; i < messages.size(); ++i)
+        {
+            threads.emplace_back([&exception, &copy, &message = messages[i], i] { message = (i % 2 == 0 ? exception : copy).what(); });
+        }
+    }
+
+    for (const std::string_view message : messages)
+    {
+        CHECK(message == "Unknown option \"--confg\", did you mean \"--config\"?");
+        CHECK(message.data() == messages.front().data());
+    }
+}
+
+TEST_CASE("Suggestion cost for a 1000-option parser", "[suggestions][!benchmark]")
+{
+    const auto                         storage = make_identifiers<1000>();
+    std::array<std::string_view, 1000> identifiers{};
+    std::ranges::copy(storage, identifiers.begin());
+
+    const std::string typo = std::string(identifiers[500]).insert(4, "x");
+
+    BENCHMARK("closest_identifier, typo")
+    {
+        return CLArgs::closest_identifier(identifiers, typo);
+    };
+
+    BENCHMARK("closest_identifier, no match")
+    {
+        return CLArgs::closest_identifier(identifiers, "--completely-unrelated-argument");
+    };
+}
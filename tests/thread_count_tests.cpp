@@ -0,0 +1,191 @@
+#include <CLArgs/common_options.hpp>
+#include <CLArgs/format_value.hpp>
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/thread_count.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+    // A cgroup2 mount and /proc/self/cgroup file below a temporary directory
+    class CgroupFixture
+    {
+    public:
+        CgroupFixture()
+            : root_{std::filesystem::temp_directory_path() / ("clargs_cgroup_" + std::to_string(std::random_device{}()))}
+        {
+            std::filesystem::create_directories(root_ / "fs");
+        }
+
+        ~CgroupFixture()
+        {
+            std::error_code ec;
+            std::filesystem::remove_all(root_, ec);
+        }
+
+        CgroupFixture(const CgroupFixture &)            = delete;
+        CgroupFixture &operator=(const CgroupFixture &) = delete;
+
+        void
+        write(const std::filesystem::path &relative_path, const std::string_view contents) const
+        {
+            const std::filesystem::path path = root_ / relative_path;
+            std::filesystem::create_directories(path.parent_path());
+            std::ofstream{path, std::ios::binary} << contents;
+        }
+
+        [[nodiscard]] std::filesystem::path
+        cgroup_root() const
+        {
+            return root_ / "fs";
+        }
+
+        [[nodiscard]] std::filesystem::path
+        proc_cgroup() const
+        {
+            return root_ / "cgroup";
+        }
+
+    private:
+        std::filesystem::path root_;
+    };
+} // namespace
+
+TEST_CASE("Parse thread counts", "[thread_count]")
+{
+    CHECK(CLArgs::parse_value<CLArgs::ThreadCount>("auto") == CLArgs::ThreadCount{});
+    CHECK(CLArgs::parse_value<CLArgs::ThreadCount>("8") == CLArgs::ThreadCount{8, 1.0});
+    CHECK(CLArgs::parse_value<CLArgs::ThreadCount>("0.5x") == CLArgs::ThreadCount{0, 0.5});
+    CHECK(CLArgs::parse_value<CLArgs::ThreadCount>("2x") == CLArgs::ThreadCount{0, 2.0});
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("0"), Catch::Matchers::ContainsSubstring("at least 1"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("0x"), Catch::Matchers::ContainsSubstring("must be positive"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("-1x"), Catch::Matchers::ContainsSubstring("must be positive"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("x"), Catch::Matchers::ContainsSubstring("like 0.5x"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("8 threads"), Catch::Matchers::ContainsSubstring("at offset 1"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<CLArgs::ThreadCount>("99999999999"), Catch::Matchers::ContainsSubstring("out of range"));
+    CHECK_THROWS_AS(CLArgs::parse_value<CLArgs::ThreadCount>("Auto"), std::invalid_argument);
+}
+
+TEST_CASE("Resolve thread counts", "[thread_count]")
+{
+    STATIC_REQUIRE(CLArgs::ThreadCount{12, 1.0}.resolve(4) == 12);
+    STATIC_REQUIRE(CLArgs::ThreadCount{}.resolve(6) == 6);
+    STATIC_REQUIRE(CLArgs::ThreadCount{0, 0.5}.resolve(6) == 3);
+    STATIC_REQUIRE(CLArgs::ThreadCount{0, 0.5}.resolve(3) == 1);
+    STATIC_REQUIRE(CLArgs::ThreadCount{0, 0.25}.resolve(2) == 1);
+    STATIC_REQUIRE(CLArgs::ThreadCount{0, 1.5}.resolve(4) == 6);
+
+    CHECK(CLArgs::ThreadCount{}.resolve() >= 1);
+    CHECK(CLArgs::ThreadCount{}.resolve() <= CLArgs::affinity_cpu_count());
+}
+
+TEST_CASE("Format thread counts", "[thread_count]")
+{
+    const auto format = [](const CLArgs::ThreadCount &value)
+    {
+        std::string result(CLArgs::format_value(value, nullptr), '\0');
+        CLArgs::format_value(value, result.data());
+        return result;
+    };
+
+    CHECK(format(CLArgs::ThreadCount{}) == "auto");
+    CHECK(format(CLArgs::ThreadCount{16, 1.0}) == "16");
+    CHECK(format(CLArgs::ThreadCount{0, 0.75}) == "0.75x");
+    CHECK(CLArgs::parse_value<CLArgs::ThreadCount>(format(CLArgs::ThreadCount{0, 0.75})) == CLArgs::ThreadCount{0, 0.75});
+}
+
+TEST_CASE("Read cgroup v2 files", "[thread_count]")
+{
+    STATIC_REQUIRE(CLArgs::cgroup_v2_path("0::/system.slice/app.service\n") == "/system.slice/app.service");
+    STATIC_REQUIRE(CLArgs::cgroup_v2_path("12:cpu,cpuacct:/docker/abc\n0::/docker/abc\n") == "/docker/abc");
+    STATIC_REQUIRE_FALSE(CLArgs::cgroup_v2_path("12:cpu,cpuacct:/docker/abc\n").has_value());
+    STATIC_REQUIRE_FALSE(CLArgs::cgroup_v2_path("").has_value());
+
+    CHECK(CLArgs::parse_cpu_max("150000 100000\n") == 1.5);
+    CHECK(CLArgs::parse_cpu_max("50000 100000") == 0.5);
+    CHECK_FALSE(CLArgs::parse_cpu_max("max 100000\n").has_value());
+    CHECK_FALSE(CLArgs::parse_cpu_max("150000 0").has_value());
+    CHECK_FALSE(CLArgs::parse_cpu_max("150000").has_value());
+    CHECK_FALSE(CLArgs::parse_cpu_max("a b").has_value());
+}
+
+TEST_CASE("Usable CPUs follow the cgroup CPU quota", "[thread_count]")
+{
+    const CgroupFixture fixture;
+    const std::uint32_t affinity = CLArgs::affinity_cpu_count();
+
+    SECTION("The smallest quota of the cgroup and its ancestors applies")
+    {
+        fixture.write("cgroup", "0::/kubepods/pod1/app\n");
+        fixture.write("fs/cpu.max", "max 100000\n");
+        fixture.write("fs/kubepods/cpu.max", "max 100000\n");
+        fixture.write("fs/kubepods/pod1/cpu.max", "150000 100000\n");
+        fixture.write("fs/kubepods/pod1/app/cpu.max", "400000 100000\n");
+
+        CHECK(CLArgs::cgroup_cpu_quota(fixture.cgroup_root(), "/kubepods/pod1/app") == 1.5);
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == std::min(affinity, std::uint32_t{2}));
+    }
+
+    SECTION("A quota below one CPU still allows one thread")
+    {
+        fixture.write("cgroup", "0::/\n");
+        fixture.write("fs/cpu.max", "10000 100000\n");
+
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == 1);
+        CHECK(CLArgs::ThreadCount{0, 4.0}.resolve(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup())) == 4);
+    }
+
+    SECTION("Without a quota, the affinity mask applies")
+    {
+        fixture.write("cgroup", "0::/user.slice\n");
+        fixture.write("fs/user.slice/cpu.max", "max 100000\n");
+
+        CHECK_FALSE(CLArgs::cgroup_cpu_quota(fixture.cgroup_root(), "/user.slice").has_value());
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == affinity);
+    }
+
+    SECTION("A cgroup outside of the namespace only sees the root")
+    {
+        fixture.write("cgroup", "0::/../../other\n");
+        fixture.write("fs/cpu.max", "100000 100000\n");
+
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == 1);
+    }
+
+    SECTION("Missing files, or cgroup v1 only")
+    {
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == affinity);
+
+        fixture.write("cgroup", "4:cpu,cpuacct:/docker/abc\n");
+        CHECK(CLArgs::usable_cpu_count(fixture.cgroup_root(), fixture.proc_cgroup()) == affinity);
+    }
+}
+
+TEST_CASE("Parser with a thread count option", "[thread_count]")
+{
+    auto parser = CLArgs::ParserBuilder{}.add_option<CLArgs::CommonOptions::Threads>().build();
+
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--threads", "auto"}));
+    REQUIRE(parser.get_option<CLArgs::CommonOptions::Threads>().has_value());
+    CHECK(parser.get_option<CLArgs::CommonOptions::Threads>()->is_relative());
+
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--threads", "12"}));
+    CHECK(parser.get_option<CLArgs::CommonOptions::Threads>()->resolve() == 12);
+
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--threads", "many"}), Catch::Matchers::ContainsSubstring("thread count"));
+}
@@ -0,0 +1,124 @@
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/utf8.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+TEST_CASE("Well-formed UTF-8 is accepted", "[utf8]")
+{
+    CHECK(CLArgs::is_valid_utf8(""));
+    CHECK(CLArgs::is_valid_utf8("plain ASCII"));
+    CHECK(CLArgs::is_valid_utf8("\xC2\x80"));             // U+0080
+    CHECK(CLArgs::is_valid_utf8("\xDF\xBF"));             // U+07FF
+    CHECK(CLArgs::is_valid_utf8("\xE0\xA0\x80"));         // U+0800
+    CHECK(CLArgs::is_valid_utf8("\xED\x9F\xBF"));         // U+D7FF
+    CHECK(CLArgs::is_valid_utf8("\xEE\x80\x80"));         // U+E000
+    CHECK(CLArgs::is_valid_utf8("\xF0\x90\x80\x80"));     // U+10000
+    CHECK(CLArgs::is_valid_utf8("\xF4\x8F\xBF\xBF"));     // U+10FFFF
+    CHECK(CLArgs::is_valid_utf8("Gr\xC3\xBC\xC3\x9F" "e, \xE4\xB8\x96\xE7\x95\x8C \xF0\x9F\x8C\x8D"));
+}
+
+TEST_CASE("Ill-formed UTF-8 is rejected at the first invalid byte", "[utf8]")
+{
+    CHECK(CLArgs::find_invalid_utf8("\x80") == 0);                  // Lone continuation byte
+    CHECK(CLArgs::find_invalid_utf8("ab\xC0\xAF") == 2);            // Overlong "/"
+    CHECK(CLArgs::find_invalid_utf8("\xC1\xBF") == 0);              // Overlong
+    CHECK(CLArgs::find_invalid_utf8("\xE0\x9F\xBF") == 0);          // Overlong
+    CHECK(CLArgs::find_invalid_utf8("\xED\xA0\x80") == 0);          // Surrogate U+D800
+    CHECK(CLArgs::find_invalid_utf8("\xF0\x8F\xBF\xBF") == 0);      // Overlong
+    CHECK(CLArgs::find_invalid_utf8("\xF4\x90\x80\x80") == 0);      // Above U+10FFFF
+    CHECK(CLArgs::find_invalid_utf8("\xF5\x80\x80\x80") == 0);
+    CHECK(CLArgs::find_invalid_utf8("\xFF") == 0);
+    CHECK(CLArgs::find_invalid_utf8("abc\xE2\x82") == 3);           // Truncated
+    CHECK(CLArgs::find_invalid_utf8("\xE2\x82x") == 0);
+
+    // The invalid byte after a long ASCII run, found by the vectorized scan
+    const std::string long_value = std::string(1000, 'a') + "\xC3" + std::string(100, 'b');
+    CHECK(CLArgs::find_invalid_utf8(long_value) == 1000);
+}
+
+TEST_CASE("Vectorized and scalar validation agree", "[utf8]")
+{
+    std::mt19937                       generator{42};
+    std::uniform_int_distribution<int> byte{0, 255};
+    std::uniform_int_distribution<int> position{0, 299};
+
+    constexpr std::array<std::string_view, 4> samples{"a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80"};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::string value;
+        while (value.size() < 300)
+        {
+            value += samples[static_cast<std::size_t>(byte(generator)) % (i % 2 == 0 ? 1 : samples.size())];
+        }
+
+        // Corrupt some of the strings
+        if (i % 3 == 0)
+        {
+            value[static_cast<std::size_t>(position(generator))] = static_cast<char>(byte(generator));
+        }
+
+        REQUIRE(CLArgs::find_invalid_utf8(value) == CLArgs::find_invalid_utf8_scalar(value));
+    }
+}
+
+TEST_CASE("Parser validates string values when asked to", "[utf8]")
+{
+    using NameOption = CLArgs::Option<"--name", "<name>", "Name", std::string>;
+    using PathOption = CLArgs::Option<"--path", "<path>", "Path", std::filesystem::path>;
+    using SizeOption = CLArgs::Option<"--size", "<size>", "Size", int>;
+
+    auto parser = CLArgs::ParserBuilder{}.add_option<NameOption>().add_option<PathOption>().add_option<SizeOption>().build();
+
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--name", "caf\xC3\xA9", "--path", "\xFF"}));
+
+    parser.validate_utf8();
+    REQUIRE_NOTHROW(parser.parse("program", std::array{"--name", "caf\xC3\xA9", "--size", "1"}));
+    REQUIRE(parser.get_option<NameOption>() == "caf\xC3\xA9");
+
+    CHECK_THROWS_WITH(parser.parse("program", std::array{"--path", "dir/\xFF"}),
+                      Catch::Matchers::Equals("Invalid UTF-8 in value for option \"--path\" at offset 4"));
+    CHECK_THROWS_AS(parser.parse("program", std::array{"--name", "caf\xE9"}), std::invalid_argument);
+}
+
+TEST_CASE("UTF-8 validation of a multi-megabyte value", "[utf8][!benchmark]")
+{
+    const std::string ascii = std::string(4 * 1024 * 1024, 'x');
+
+    std::string mixed;
+    while (mixed.size() < 4 * 1024 * 1024)
+    {
+        mixed += "Some text with an umlaut, \xC3\xBC, and an emoji, \xF0\x9F\x98\x80. ";
+    }
+
+    BENCHMARK("find_invalid_utf8, ASCII")
+    {
+        return CLArgs::find_invalid_utf8(ascii);
+    };
+
+    BENCHMARK("find_invalid_utf8_scalar, ASCII")
+    {
+        return CLArgs::find_invalid_utf8_scalar(ascii);
+    };
+
+    BENCHMARK("find_invalid_utf8, mixed")
+    {
+        return CLArgs::find_invalid_utf8(mixed);
+    };
+
+    BENCHMARK("find_invalid_utf8_scalar, mixed")
+    {
+        return CLArgs::find_invalid_utf8_scalar(mixed);
+    };
+}
@@ -3,7 +3,9 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
 #include <filesystem>
+#include <string>
 
 using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
 using FileOption  = CLArgs::Option<"--file", "FILE", "Specify file to load", std::filesystem::path>;
@@ -148,3 +150,29 @@ TEST_CASE("Values in ValueContainer can be reset to std::nullopt using reset()",
         REQUIRE(container.get_value<FileOption>().value() == "new_config.ini");
     }
 }
+
+using ThreadsOption = CLArgs::Option<"--threads", "<number>", "Specify thread count", std::uint16_t, 4>;
+using HostOption    = CLArgs::Option<"--host", "<host>", "Specify host", std::string, "localhost">;
+
+TEST_CASE("Options with a default value always hold a value", "[value_container]")
+{
+    CLArgs::ValueContainer<VerboseFlag, ThreadsOption, HostOption> container;
+
+    REQUIRE(container.get_value<ThreadsOption>().has_value());
+    CHECK(container.get_value<ThreadsOption>().value() == 4);
+    REQUIRE(container.get_value<HostOption>().has_value());
+    CHECK(container.get_value<HostOption>().value() == "localhost");
+
+    CHECK_FALSE(container.is_set<VerboseFlag>());
+    CHECK_FALSE(container.is_set<ThreadsOption>());
+    CHECK_FALSE(container.is_set<HostOption>());
+
+    container.set_value<ThreadsOption>(16);
+    CHECK(container.get_value<ThreadsOption>().value() == 16);
+    CHECK(container.is_set<ThreadsOption>());
+    CHECK_FALSE(container.is_set<HostOption>());
+
+    container.reset();
+    CHECK(container.get_value<ThreadsOption>().value() == 4);
+    CHECK_FALSE(container.is_set<ThreadsOption>());
+}
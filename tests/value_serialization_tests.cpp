@@ -0,0 +1,251 @@
+#include <CLArgs/inline_vector.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/value_container.hpp>
+#include <CLArgs/value_serialization.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using VerboseFlag = CLArgs::Flag<"--verbose,-v", "Enable verbose output">;
+    using CountOption = CLArgs::Option<"--count", "N", "Number of items", int>;
+    using RatioOption = CLArgs::Option<"--ratio", "R", "Ratio", double, 0.5>;
+    using DelayOption = CLArgs::Option<"--delay", "MS", "Delay", std::chrono::milliseconds>;
+    using NameOption   = CLArgs::Option<"--name", "NAME", "Name", std::string>;
+    using TagOption    = CLArgs::Option<"--tag", "TAG", "Tag", std::pmr::string>;
+    using FileOption   = CLArgs::Option<"--file", "FILE", "File", std::filesystem::path>;
+    using LabelOption = CLArgs::Option<"--label", "LABEL", "Label", std::string_view>;
+    using EmptyOption = CLArgs::Option<"--empty", "EMPTY", "Never set", int>;
+
+    using Container = CLArgs::
+        ValueContainer<VerboseFlag, CountOption, RatioOption, DelayOption, NameOption, TagOption, FileOption, LabelOption, EmptyOption>;
+
+    using PortsOption   = CLArgs::Option<"--ports", "PORTS", "Ports", CLArgs::InlineVector<std::uint16_t, 4>>;
+    using HostsOption   = CLArgs::Option<"--hosts", "HOSTS", "Hosts", std::array<std::string_view, 2>>;
+    using ListContainer = CLArgs::ValueContainer<PortsOption, HostsOption>;
+
+    template <typename T>
+    constexpr std::uint64_t schema_hash_of = CLArgs::ValueContainer<CLArgs::Option<"--value", "V", "Value", T>>::schema_hash;
+
+    struct RawPointer
+    {
+        const char *text;
+    };
+} // namespace
+
+TEST_CASE("Serialized values round-trip", "[value_serialization]")
+{
+    Container original;
+    original.set_value<VerboseFlag>(true);
+    original.set_value<CountOption>(-42);
+    original.set_value<DelayOption>(std::chrono::milliseconds{250});
+    original.set_value<NameOption>("a name that does not fit into the small string buffer");
+    original.set_value<TagOption>(std::pmr::string{"tag"});
+    original.set_value<FileOption>("/var/run/service.sock");
+    original.set_value<LabelOption>("label");
+
+    const auto blob = original.serialize();
+    REQUIRE(blob.size() == original.serialized_size());
+
+    Container loaded;
+    loaded.deserialize(blob);
+
+    REQUIRE(loaded.get_value<VerboseFlag>() == true);
+    REQUIRE(loaded.get_value<CountOption>() == -42);
+    REQUIRE(loaded.get_value<RatioOption>() == 0.5);
+    REQUIRE(loaded.get_value<DelayOption>() == std::chrono::milliseconds{250});
+    REQUIRE(loaded.get_value<NameOption>() == original.get_value<NameOption>());
+    REQUIRE(loaded.get_value<TagOption>() == "tag");
+    REQUIRE(loaded.get_value<FileOption>() == std::filesystem::path{"/var/run/service.sock"});
+    REQUIRE(loaded.get_value<LabelOption>() == "label");
+    REQUIRE_FALSE(loaded.get_value<EmptyOption>().has_value());
+
+    REQUIRE(loaded.is_set<CountOption>());
+    REQUIRE_FALSE(loaded.is_set<RatioOption>());
+    REQUIRE_FALSE(loaded.is_set<EmptyOption>());
+}
+
+TEST_CASE("Deserialized values use the container's memory resource", "[value_serialization]")
+{
+    Container original;
+    original.set_value<TagOption>(std::pmr::string{"a tag that does not fit into the small string buffer"});
+    const auto blob = original.serialize();
+
+    std::array<std::byte, 1024>         buffer{};
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    Container loaded{&resource};
+    loaded.deserialize(blob);
+
+    REQUIRE(loaded.get_value<TagOption>() == original.get_value<TagOption>());
+    REQUIRE(loaded.get_value<TagOption>()->get_allocator().resource() == &resource);
+}
+
+TEST_CASE("String views refer into the serialized blob", "[value_serialization]")
+{
+    Container original;
+    original.set_value<LabelOption>("label");
+
+    // Stands in for a snapshot file mapped into memory
+    const auto                   blob = original.serialize();
+    const std::vector<std::byte> mapped(blob.begin(), blob.end());
+
+    Container loaded;
+    loaded.deserialize(mapped);
+
+    const std::string_view label = *loaded.get_value<LabelOption>();
+    REQUIRE(label == "label");
+    REQUIRE(reinterpret_cast<const std::byte *>(label.data()) >= mapped.data());
+    REQUIRE(reinterpret_cast<const std::byte *>(label.data()) < mapped.data() + mapped.size());
+}
+
+TEST_CASE("Lists are serialized element by element", "[value_serialization]")
+{
+    CLArgs::InlineVector<std::uint16_t, 4> ports;
+    ports.push_back(80);
+    ports.push_back(443);
+    ports.push_back(8080);
+
+    ListContainer original;
+    original.set_value<PortsOption>(ports);
+    original.set_value<HostsOption>(std::array<std::string_view, 2>{"primary", "secondary"});
+
+    const auto blob = original.serialize();
+
+    ListContainer loaded;
+    loaded.deserialize(blob);
+
+    REQUIRE(loaded.get_value<PortsOption>() == original.get_value<PortsOption>());
+    REQUIRE(loaded.get_value<HostsOption>() == original.get_value<HostsOption>());
+
+    // The views refer into the blob, not to the strings of the original
+    const std::string_view host = (*loaded.get_value<HostsOption>())[1];
+    REQUIRE(reinterpret_cast<const std::byte *>(host.data()) >= blob.data());
+    REQUIRE(reinterpret_cast<const std::byte *>(host.data()) < blob.data() + blob.size());
+
+    SECTION("Too many elements")
+    {
+        auto corrupt = blob;
+        // The size of the InlineVector follows the header and both bit sets
+        corrupt[CLArgs::value_snapshot_header_size + 2 * sizeof(std::uint64_t)] = std::byte{5};
+        REQUIRE_THROWS_AS(loaded.deserialize(corrupt), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Only value types without pointers are serializable", "[value_serialization]")
+{
+    STATIC_REQUIRE(CLArgs::SerializableValue<int>);
+    STATIC_REQUIRE(CLArgs::SerializableValue<std::chrono::seconds>);
+    STATIC_REQUIRE(CLArgs::SerializableValue<std::array<std::string_view, 2>>);
+    STATIC_REQUIRE(CLArgs::SerializableValue<CLArgs::InlineVector<std::string, 4>>);
+    STATIC_REQUIRE(CLArgs::SerializableValue<CLArgs::Endpoint>);
+
+    STATIC_REQUIRE_FALSE(CLArgs::SerializableValue<RawPointer>);
+    STATIC_REQUIRE_FALSE(CLArgs::SerializableValue<const char *>);
+    STATIC_REQUIRE_FALSE(CLArgs::SerializableValue<std::array<RawPointer, 2>>);
+}
+
+TEST_CASE("Schema hash tells apart value types of the same layout", "[value_serialization]")
+{
+    STATIC_REQUIRE(schema_hash_of<std::chrono::seconds> != schema_hash_of<std::chrono::milliseconds>);
+    STATIC_REQUIRE(schema_hash_of<std::int64_t> != schema_hash_of<std::chrono::nanoseconds>);
+    STATIC_REQUIRE(schema_hash_of<CLArgs::Rate> != schema_hash_of<CLArgs::ThreadCount>);
+    STATIC_REQUIRE(schema_hash_of<std::array<int, 2>> != schema_hash_of<std::array<int, 3>>);
+    STATIC_REQUIRE(schema_hash_of<std::array<int, 2>> != schema_hash_of<std::array<float, 2>>);
+    STATIC_REQUIRE(schema_hash_of<CLArgs::InlineVector<int, 2>> != schema_hash_of<CLArgs::InlineVector<int, 3>>);
+    STATIC_REQUIRE(schema_hash_of<int> == schema_hash_of<int>);
+}
+
+TEST_CASE("Invalid snapshots are rejected", "[value_serialization]")
+{
+    Container original;
+    original.set_value<CountOption>(7);
+    original.set_value<NameOption>("name");
+    auto blob = original.serialize();
+
+    Container loaded;
+    loaded.set_value<CountOption>(1);
+
+    SECTION("Different schema")
+    {
+        CLArgs::ValueContainer<VerboseFlag, CountOption> other;
+        REQUIRE(other.schema_hash != Container::schema_hash);
+        REQUIRE_THROWS_AS(loaded.deserialize(other.serialize()), std::invalid_argument);
+    }
+
+    SECTION("Truncated")
+    {
+        REQUIRE_THROWS_AS(loaded.deserialize(std::span{blob}.first(blob.size() - 1)), std::invalid_argument);
+    }
+
+    SECTION("Corrupt string length")
+    {
+        blob[blob.size() - 5] = std::byte{0xff};
+        REQUIRE_THROWS_AS(loaded.deserialize(blob), std::invalid_argument);
+    }
+
+    SECTION("Invalid bool")
+    {
+        CLArgs::ValueContainer<VerboseFlag> flags;
+        flags.set_value<VerboseFlag>(true);
+        auto flag_blob = flags.serialize();
+
+        flag_blob.back() = std::byte{2};
+        REQUIRE_THROWS_AS(flags.deserialize(flag_blob), std::invalid_argument);
+        REQUIRE(flags.get_value<VerboseFlag>() == true);
+    }
+
+    SECTION("Not a snapshot")
+    {
+        blob[0] = std::byte{0};
+        REQUIRE_THROWS_AS(loaded.deserialize(blob), std::invalid_argument);
+    }
+
+    REQUIRE(loaded.get_value<CountOption>() == 1);
+    REQUIRE(loaded.is_set<CountOption>());
+}
+
+TEST_CASE("Serialize into a caller-supplied buffer", "[value_serialization]")
+{
+    Container original;
+    original.set_value<CountOption>(3);
+
+    std::array<std::byte, 4> too_small{};
+    REQUIRE_THROWS_AS(original.serialize(too_small), std::invalid_argument);
+
+    std::array<std::byte, 256> buffer{};
+    const std::size_t          size = original.serialize(buffer);
+    REQUIRE(size == original.serialized_size());
+
+    Container loaded;
+    loaded.deserialize(std::span{buffer}.first(size));
+    REQUIRE(loaded.get_value<CountOption>() == 3);
+}
+
+TEST_CASE("Parser values can be handed to another parser", "[value_serialization]")
+{
+    auto builder = CLArgs::ParserBuilder{}.add_flag<VerboseFlag>().add_option<NameOption>().add_option<RatioOption>();
+
+    auto master = builder.build();
+    master.parse("master", std::array{"-v", "--name", "worker", "--ratio", "0.25"});
+    const auto blob = master.serialize_values();
+
+    auto worker = builder.build();
+    worker.deserialize_values("worker", blob);
+
+    REQUIRE(worker.program() == "worker");
+    REQUIRE(worker.has_flag<VerboseFlag>());
+    REQUIRE(worker.get_option<NameOption>() == "worker");
+    REQUIRE(worker.get<RatioOption>() == 0.25);
+}
@@ -0,0 +1,138 @@
+#include <CLArgs/parse_value.hpp>
+#include <CLArgs/parser_builder.hpp>
+#include <CLArgs/value_traits.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+    // "<index>/<count>", like "3/16"
+    struct ShardSpec
+    {
+        std::uint32_t index{0};
+        std::uint32_t count{1};
+
+        bool operator==(const ShardSpec &) const = default;
+    };
+
+    // No display name, so error messages fall back to the typeid name
+    struct Id
+    {
+        std::uint64_t value{0};
+    };
+} // namespace
+
+template <>
+struct CLArgs::ValueTraits<ShardSpec>
+{
+    static constexpr std::string_view name{"shard spec"};
+
+    static ValueParseResult
+    parse(const std::string_view sv, ShardSpec &out) noexcept
+    {
+        const char *first = sv.data();
+        const char *last  = sv.data() + sv.size();
+
+        auto [index_end, index_ec] = std::from_chars(first, last, out.index);
+        if (index_ec != std::errc{})
+        {
+            return {index_ec == std::errc::result_out_of_range ? ParseStatus::OutOfRange : ParseStatus::InvalidFormat, 0, {}};
+        }
+
+        if (index_end == last || *index_end != '/')
+        {
+            return {ParseStatus::InvalidFormat, static_cast<std::size_t>(index_end - first), "Expected '/'"};
+        }
+
+        auto [count_end, count_ec] = std::from_chars(index_end + 1, last, out.count);
+        if (count_ec != std::errc{} || count_end != last)
+        {
+            return {ParseStatus::InvalidFormat, static_cast<std::size_t>(count_end - first), {}};
+        }
+
+        if (out.index >= out.count)
+        {
+            return {ParseStatus::OutOfRange, 0, "Shard index must be less than the shard count"};
+        }
+
+        return {};
+    }
+};
+
+template <>
+struct CLArgs::ValueTraits<Id>
+{
+    static ValueParseResult
+    parse(const std::string_view sv, Id &out) noexcept
+    {
+        const auto [end, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), out.value, 16);
+        if (ec != std::errc{} || end != sv.data() + sv.size())
+        {
+            return {ParseStatus::InvalidFormat, static_cast<std::size_t>(end - sv.data()), {}};
+        }
+        return {};
+    }
+};
+
+TEST_CASE("ValueTraits types are parsable", "[value_traits]")
+{
+    STATIC_REQUIRE(CLArgs::TraitsParsableValue<ShardSpec>);
+    STATIC_REQUIRE(CLArgs::NamedValueTraits<ShardSpec>);
+    STATIC_REQUIRE(CLArgs::TraitsParsableValue<Id>);
+    STATIC_REQUIRE_FALSE(CLArgs::NamedValueTraits<Id>);
+    STATIC_REQUIRE_FALSE(CLArgs::TraitsParsableValue<int>);
+
+    STATIC_REQUIRE(CLArgs::pretty_string_of_type<ShardSpec>() == "shard spec");
+
+    CHECK(CLArgs::parse_value<ShardSpec>("3/16") == ShardSpec{3, 16});
+    CHECK(CLArgs::parse_value<Id>("ff").value == 255);
+
+    CHECK_THROWS_WITH(CLArgs::parse_value<ShardSpec>("3-16"),
+                      Catch::Matchers::Equals("Unable to parse \"3-16\" as type \"shard spec\": Expected '/' at offset 1"));
+    CHECK_THROWS_WITH(CLArgs::parse_value<ShardSpec>("3/1x"), Catch::Matchers::EndsWith("Invalid format at offset 3"));
+    CHECK_THROWS_AS(CLArgs::parse_value<Id>("xyz"), CLArgs::ParseValueException<Id>);
+}
+
+TEST_CASE("try_parse_value() reports errors without throwing", "[value_traits]")
+{
+    ShardSpec spec;
+    CHECK(CLArgs::try_parse_value("1/2", spec));
+    CHECK(spec == ShardSpec{1, 2});
+
+    const CLArgs::ValueParseResult result = CLArgs::try_parse_value("16/16", spec);
+    CHECK_FALSE(result);
+    CHECK(result.status == CLArgs::ParseStatus::OutOfRange);
+    CHECK(result.message == "Shard index must be less than the shard count");
+
+    STATIC_REQUIRE(noexcept(CLArgs::try_parse_value(std::string_view{}, spec)));
+
+    // Types without ValueTraits go through parse_value<T>()
+    int number = 0;
+    CHECK(CLArgs::try_parse_value("42", number));
+    CHECK(number == 42);
+    CHECK(CLArgs::try_parse_value("forty-two", number).status == CLArgs::ParseStatus::InvalidFormat);
+}
+
+TEST_CASE("Parser constructs ValueTraits types in place", "[value_traits]")
+{
+    using ShardOption = CLArgs::Option<"--shard", "<index>/<count>", "Shard of the input to process", ShardSpec>;
+
+    auto parser = CLArgs::ParserBuilder{}.add_option<ShardOption>().build();
+
+    parser.parse("worker", std::array{"--shard", "7/8"});
+    REQUIRE(parser.get_option<ShardOption>() == ShardSpec{7, 8});
+
+    CHECK_THROWS_WITH(parser.parse("worker", std::array{"--shard", "8/8"}),
+                      Catch::Matchers::Equals("Failed to parse value for option \"--shard\": "
+                                              "Unable to parse \"8/8\" as type \"shard spec\": "
+                                              "Shard index must be less than the shard count at offset 0"));
+    CHECK_FALSE(parser.get_option<ShardOption>().has_value());
+}